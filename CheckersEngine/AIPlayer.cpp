@@ -1,16 +1,81 @@
 #include "AIPlayer.h"
 
+#include "AlphaBetaSearch.h"
 #include "CheckersBoard.h"
 #include "CheckersBoardNode.h"
+#include "LazySmpSearch.h"
+#include "TimeManager.h"
+#include "TranspositionTable.h"
 
 #include <queue>
 #include <vector>
 
 using namespace checkers;
 
+const int AIPlayer::DefaultSearchDepth;
+const int AIPlayer::DefaultHashSizeMB;
+const int AIPlayer::DefaultThreadCount;
+
+AIPlayer::AIPlayer() :
+	m_searchMode(SearchMode::GameTree),
+	m_searchDepth(DefaultSearchDepth),
+	m_hashSizeMB(DefaultHashSizeMB),
+	m_moveTime(0),
+	m_nodeLimit(0),
+	m_threadCount(DefaultThreadCount),
+	m_isDeterministic(false)
+{
+}
+
+AIPlayer::~AIPlayer()
+{
+}
+
+void AIPlayer::SetHashSizeMB(int hashSizeMB)
+{
+	m_hashSizeMB = hashSizeMB;
+	m_transpositionTable.reset();
+}
+
 Move AIPlayer::ChooseBestMove(const CheckersBoard& board) const
 {
-	CheckersBoardNode topNode(nullptr, board, Move(), CheckersBoard::GetWinTypeFromSideType(board.GetCurrentSide()));
+	if (m_searchMode == SearchMode::GameTree) return ChooseGameTreeMove(board);
+	return ChooseAlphaBetaMove(board, nullptr);
+}
+
+Move AIPlayer::ChooseBestMove(const CheckersBoard& board, double remainingSeconds, double incrementSeconds, int movesToGo) const
+{
+	if (m_searchMode == SearchMode::GameTree) return ChooseGameTreeMove(board);
+
+	TimeManager::Clock clock;
+	clock.remainingSeconds = remainingSeconds;
+	clock.incrementSeconds = incrementSeconds;
+	clock.movesToGo = movesToGo;
+	TimeManager timeManager(board, clock);
+	return ChooseAlphaBetaMove(board, &timeManager);
+}
+
+Move AIPlayer::ChooseAlphaBetaMove(const CheckersBoard& board, TimeManager* timeManager) const
+{
+	if (m_hashSizeMB > 0) {
+		if (!m_transpositionTable) m_transpositionTable.reset(new TranspositionTable(m_hashSizeMB));
+		m_transpositionTable->NewSearch();
+	}
+
+	LazySmpSearch search(m_transpositionTable.get(), m_threadCount);
+	search.SetDeterministic(m_isDeterministic);
+
+	AlphaBetaSearch::Limits limits;
+	limits.maxDepth = m_searchDepth;
+	limits.maxNodes = m_nodeLimit;
+	limits.maxSeconds = m_moveTime;
+	limits.timeManager = timeManager;
+	return search.Search(board, limits).bestMove.GetFirstHop();
+}
+
+Move AIPlayer::ChooseGameTreeMove(const CheckersBoard& board) const
+{
+	CheckersBoardNode topNode(nullptr, board, MovePath(), CheckersBoard::GetWinTypeFromSideType(board.GetCurrentSide()));
 
 	std::queue<CheckersBoardNode*> nodeStack;
 	nodeStack.push(&topNode);
@@ -20,14 +85,15 @@ Move AIPlayer::ChooseBestMove(const CheckersBoard& board) const
 		CheckersBoardNode* currentNode = nodeStack.front();
 		nodeStack.pop();
 
-		auto childNodes = currentNode->GetChildNodes();
+		auto& childNodes = currentNode->GetChildNodes();
 
-		for (auto childNode : childNodes)
+		for (auto& childNode : childNodes)
 		{
 			nodeStack.push(&childNode);
 			childNode.PropogateWin();
 		}
 	}
 
-	return topNode.GetBestMove();
+	// A capture sequence is searched as a single move, return its first jump.
+	return topNode.GetBestMove().GetFirstHop();
 }
@@ -1,16 +1,90 @@
 #pragma once
 
+#include "BoardGeometry.h"
 #include "Move.h"
 
+#include <cstdint>
+#include <memory>
+
 namespace checkers {
 
 // fwd decls
-class CheckersBoard;
+template<typename Geometry> class BasicCheckersBoard;
+typedef BasicCheckersBoard<Geometry8x8> CheckersBoard;
+class TimeManager;
+class TranspositionTable;
 
 class AIPlayer
 {
 public:
+	/// How ChooseBestMove finds its move.
+	enum class SearchMode {
+		/// Builds the whole game tree and picks the move with the most wins below it. Only finishes on near empty boards.
+		GameTree,
+		/// Iterative deepening alpha-beta to the search depth, on the search threads. See LazySmpSearch.
+		AlphaBeta
+	};
+
+	static const int DefaultSearchDepth = 8;
+	static const int DefaultHashSizeMB = 16;
+	static const int DefaultThreadCount = 1;
+
+	AIPlayer();
+	~AIPlayer();
+
+	SearchMode GetSearchMode() const { return m_searchMode; }
+	void SetSearchMode(SearchMode searchMode) { m_searchMode = searchMode; }
+
+	/// The deepest alpha-beta iteration, in moves. Capture sequences are searched past it.
+	int GetSearchDepth() const { return m_searchDepth; }
+	void SetSearchDepth(int searchDepth) { m_searchDepth = searchDepth; }
+
+	/// The size of the alpha-beta transposition table, 0 for none. It's kept between moves.
+	int GetHashSizeMB() const { return m_hashSizeMB; }
+	void SetHashSizeMB(int hashSizeMB);
+
+	/// The longest the alpha-beta search can take over a move, 0 for no limit. The move is from the last iteration that finished.
+	double GetMoveTime() const { return m_moveTime; }
+	void SetMoveTime(double seconds) { m_moveTime = seconds; }
+
+	/// The most positions the alpha-beta search can visit for a move, 0 for no limit.
+	uint64_t GetNodeLimit() const { return m_nodeLimit; }
+	void SetNodeLimit(uint64_t nodeLimit) { m_nodeLimit = nodeLimit; }
+
+	/// The number of threads the alpha-beta search runs on. More than one needs a transposition table.
+	int GetThreadCount() const { return m_threadCount; }
+	void SetThreadCount(int threadCount) { m_threadCount = threadCount; }
+
+	/// When set, the alpha-beta move for a given board and depth doesn't depend on the thread count or timing, at some cost in speed.
+	bool IsDeterministic() const { return m_isDeterministic; }
+	void SetDeterministic(bool isDeterministic) { m_isDeterministic = isDeterministic; }
+
+	/// The alpha-beta transposition table, for its statistics. Null until the first alpha-beta search, or without one.
+	const TranspositionTable* GetTranspositionTable() const { return m_transpositionTable.get(); }
+
+	/// Choose the best move for the current side. For a capture sequence this is the first jump.
 	Move ChooseBestMove( const CheckersBoard& board ) const;
+
+	/**
+	 * Choose the best move when playing on a clock, the TimeManager decides how long to search for.
+	 * The search depth, move time and node limit still apply. The game tree search ignores the clock.
+	 */
+	Move ChooseBestMove(const CheckersBoard& board, double remainingSeconds, double incrementSeconds = 0, int movesToGo = 0) const;
+
+private:
+	Move ChooseGameTreeMove(const CheckersBoard& board) const;
+	Move ChooseAlphaBetaMove(const CheckersBoard& board, TimeManager* timeManager) const;
+
+	SearchMode m_searchMode;
+	int m_searchDepth;
+	int m_hashSizeMB;
+	double m_moveTime;
+	uint64_t m_nodeLimit;
+	int m_threadCount;
+	bool m_isDeterministic;
+
+	/// Made by the first alpha-beta search, each search after that ages the entries of the ones before.
+	mutable std::unique_ptr<TranspositionTable> m_transpositionTable;
 };
 
 }
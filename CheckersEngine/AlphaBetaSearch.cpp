@@ -0,0 +1,198 @@
+#include "AlphaBetaSearch.h"
+
+#include "MovePicker.h"
+#include "TimeManager.h"
+
+#include <algorithm>
+
+using namespace checkers;
+
+const int AlphaBetaSearch::MaxPly;
+const int AlphaBetaSearch::WinScore;
+const int AlphaBetaSearch::WinThreshold;
+const int AlphaBetaSearch::Infinity;
+const int AlphaBetaSearch::ManScore;
+const int AlphaBetaSearch::KingScore;
+const int AlphaBetaSearch::AdvanceScore;
+const int AlphaBetaSearch::LimitCheckInterval;
+
+AlphaBetaSearch::Result AlphaBetaSearch::Search( const CheckersBoard &board, int maxDepth, int startDepth )
+{
+    Limits limits;
+    limits.maxDepth = maxDepth;
+    return Search( board, limits, startDepth );
+}
+
+AlphaBetaSearch::Result AlphaBetaSearch::Search( const CheckersBoard &board, const Limits &limits, int startDepth )
+{
+    auto startTime = std::chrono::steady_clock::now();
+    m_nodes = 0;
+    m_tableStatistics = TranspositionTable::Statistics();
+    m_isStopped = false;
+    m_maxNodes = limits.maxNodes;
+
+    // Start each search with no history, so searching the same position again searches the same tree.
+    m_moveHistory.Clear();
+
+    double maxSeconds = limits.maxSeconds;
+    if ( limits.timeManager != nullptr ) {
+        double managedSeconds = limits.timeManager->GetMaximumSeconds();
+        maxSeconds = maxSeconds > 0 ? std::min( maxSeconds, managedSeconds ) : managedSeconds;
+    }
+    m_hasDeadline = maxSeconds > 0 || limits.timeManager != nullptr;
+    m_deadline = startTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>( std::chrono::duration<double>( maxSeconds ) );
+
+    Result result;
+    result.bestMove = MovePath{};
+    result.score = 0;
+    result.depth = 0;
+    result.nodes = 0;
+
+    MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    if ( movePaths.empty() ) {
+        result.score = -WinScore;
+        return result;
+    }
+
+    // Start with the best move from an earlier search. Without cutoffs the root order has to be repeatable too.
+    TranspositionTable::ProbeResult probe;
+    if ( m_transpositionTable != nullptr && m_isUsingTableCutoffs && m_transpositionTable->Probe( board.GetHash(), probe, m_tableStatistics ) && probe.moveIndex < movePaths.size() ) {
+        std::swap( movePaths[0], movePaths[probe.moveIndex] );
+    }
+
+    result.bestMove = movePaths[0];
+
+    CheckersBoard searchBoard = board;
+    CheckersBoard::UndoRecord undoRecord;
+    for ( int depth = std::max( startDepth, 1 ); depth <= std::min( limits.maxDepth, MaxPly ); depth++ ) {
+        int alpha = -Infinity;
+        int bestIndex = 0;
+        for ( int i = 0; i < movePaths.size(); i++ ) {
+            searchBoard.DoMove( movePaths[i], undoRecord );
+            int score = -Negamax( searchBoard, depth - 1, 1, -Infinity, -alpha );
+            searchBoard.UndoMove( undoRecord );
+            if ( IsStopped() ) { break; }
+
+            if ( score > alpha ) {
+                alpha = score;
+                bestIndex = i;
+            }
+        }
+
+        if ( IsStopped() ) { break; }
+
+        // The best move goes first next time, it's the most likely to be best again.
+        std::rotate( movePaths.begin(), movePaths.begin() + bestIndex, movePaths.begin() + bestIndex + 1 );
+        result.bestMove = movePaths[0];
+        result.score = alpha;
+        result.depth = depth;
+
+        if ( m_transpositionTable != nullptr ) {
+            MovePathList generatedPaths;
+            board.GetMovePaths( generatedPaths );
+            int moveIndex = static_cast<int>( std::find( generatedPaths.begin(), generatedPaths.end(), result.bestMove ) - generatedPaths.begin() );
+            m_transpositionTable->Store( board.GetHash(), depth, TranspositionTable::Bound::Exact, alpha, moveIndex, m_tableStatistics );
+        }
+
+        if ( IsWinScore( alpha ) ) { break; }
+
+        double elapsedSeconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - startTime ).count();
+        if ( limits.timeManager != nullptr && !limits.timeManager->ShouldStartIteration( elapsedSeconds, result.bestMove ) ) { break; }
+    }
+
+    if ( m_transpositionTable != nullptr ) {
+        m_transpositionTable->AddStatistics( m_tableStatistics );
+    }
+
+    result.nodes = m_nodes;
+    return result;
+}
+
+int AlphaBetaSearch::Negamax( CheckersBoard &board, int depth, int ply, int alpha, int beta )
+{
+    m_nodes++;
+    CheckLimits();
+    if ( IsStopped() ) { return 0; }
+
+    MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    if ( movePaths.empty() ) { return -( WinScore - ply ); } // Can't move means you lose
+
+    // Use a stored result that's deep enough to decide this node, and otherwise try its best move first.
+    int hashMoveIndex = -1;
+    if ( m_transpositionTable != nullptr ) {
+        TranspositionTable::ProbeResult probe;
+        if ( m_transpositionTable->Probe( board.GetHash(), probe, m_tableStatistics ) ) {
+            int score = FromTableScore( probe.score, ply );
+            if ( m_isUsingTableCutoffs && probe.depth >= std::max( depth, 0 ) &&
+                 ( probe.bound == TranspositionTable::Bound::Exact ||
+                   ( probe.bound == TranspositionTable::Bound::Lower && score >= beta ) ||
+                   ( probe.bound == TranspositionTable::Bound::Upper && score <= alpha ) ) ) {
+                return score;
+            }
+            if ( probe.moveIndex < movePaths.size() ) { hashMoveIndex = probe.moveIndex; }
+        }
+    }
+
+    // Keep going through exchanges, evaluating part way through one would miss the recapture.
+    if ( ( depth <= 0 && !movePaths[0].IsCapture() ) || ply >= MaxPly ) { return Evaluate( board ); }
+
+    int originalAlpha = alpha;
+    int bestScore = -Infinity;
+    int bestIndex = 0;
+    CheckersBoard::UndoRecord undoRecord;
+    MovePicker movePicker( board, movePaths, hashMoveIndex, m_moveHistory, ply );
+    for ( int i = movePicker.Next(); i >= 0; i = movePicker.Next() ) {
+        board.DoMove( movePaths[i], undoRecord );
+        int score = -Negamax( board, depth - 1, ply + 1, -beta, -alpha );
+        board.UndoMove( undoRecord );
+        if ( IsStopped() ) { break; }
+
+        if ( score > bestScore ) {
+            bestScore = score;
+            bestIndex = i;
+            if ( score > alpha ) { alpha = score; }
+            if ( alpha >= beta ) {
+                if ( !movePaths[i].IsCapture() ) { m_moveHistory.AddCutoff( movePaths[i], board.GetCurrentSide(), ply, depth ); }
+                break;
+            }
+        }
+    }
+
+    // A stopped search's scores are made up, keep them out of the table.
+    if ( IsStopped() ) { return 0; }
+
+    if ( m_transpositionTable != nullptr ) {
+        TranspositionTable::Bound bound = bestScore <= originalAlpha ? TranspositionTable::Bound::Upper :
+                                          bestScore >= beta ? TranspositionTable::Bound::Lower : TranspositionTable::Bound::Exact;
+        m_transpositionTable->Store( board.GetHash(), depth, bound, ToTableScore( bestScore, ply ), bestIndex, m_tableStatistics );
+    }
+    return bestScore;
+}
+
+void AlphaBetaSearch::CheckLimits()
+{
+    if ( m_stop != nullptr && m_stop->load( std::memory_order_relaxed ) ) { m_isStopped = true; }
+    if ( m_maxNodes != 0 && m_nodes >= m_maxNodes ) { m_isStopped = true; }
+    if ( m_hasDeadline && m_nodes % LimitCheckInterval == 0 && std::chrono::steady_clock::now() >= m_deadline ) { m_isStopped = true; }
+}
+
+int AlphaBetaSearch::Evaluate( const CheckersBoard &board )
+{
+    Bitboard white = board.GetPieces( CheckersBoard::SideType::White );
+    Bitboard black = board.GetPieces( CheckersBoard::SideType::Black );
+    Bitboard kings = board.GetKings();
+
+    int score = ( PopCount( white & ~kings ) - PopCount( black & ~kings ) ) * ManScore +
+                ( PopCount( white & kings ) - PopCount( black & kings ) ) * KingScore;
+
+    // White men advance up the rows, black men down them.
+    for ( int row = 1; row < CheckersBoard::NumberOfRows; row++ ) {
+        Bitboard rowMask = Geometry8x8::GetRowMask( row );
+        score += ( PopCount( white & ~kings & rowMask ) * row -
+                   PopCount( black & ~kings & Geometry8x8::GetRowMask( CheckersBoard::NumberOfRows - 1 - row ) ) * row ) * AdvanceScore;
+    }
+
+    return board.GetCurrentSide() == CheckersBoard::SideType::White ? score : -score;
+}
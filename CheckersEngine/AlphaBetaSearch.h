@@ -0,0 +1,153 @@
+#pragma once
+
+#include "CheckersBoard.h"
+#include "MovePath.h"
+#include "MovePicker.h"
+#include "TranspositionTable.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace checkers {
+
+class TimeManager;
+
+/**
+ * Negamax alpha-beta search with iterative deepening, for choosing moves in real positions.
+ * Scores are integers from the point of view of the side to move, in hundredths of a man.
+ * A side that can't move has lost, a win scores WinScore less the plies it takes, so the search prefers quicker
+ * wins and slower losses.
+ *
+ * Captures are forced, so the search carries on past the depth limit while the side to move has a capture,
+ * and positions are only evaluated once the exchanges are over.
+ * Moves are made and undone in place on one board. Each node tries its moves in the order a MovePicker gives,
+ * using the killer moves and history scores the search has learnt so far.
+ *
+ * With a TranspositionTable, results are stored by position and reused when the position comes up again, and the
+ * stored best move is tried first. Searches on different threads can share a table, each counts its use of the
+ * table itself and adds the counts to the table's statistics when it finishes.
+ *
+ * Scores the search takes from the table depend on what else has been stored there, which with other threads
+ * storing isn't repeatable. With table cutoffs turned off the table only orders moves, and the best move and score
+ * are the same as searching without one.
+ *
+ * The search can be limited by depth, nodes and time. When a limit is hit part way through an iteration that
+ * iteration is abandoned, and the result is always the last one completed.
+ */
+class AlphaBetaSearch
+{
+public:
+    /// The deepest the search goes, including the captures played past the depth limit.
+    static const int MaxPly = 128;
+
+    /// The score of winning now. A win in n plies scores WinScore - n.
+    static const int WinScore = 30000;
+
+    /// Scores beyond this, either way, are forced wins or losses rather than evaluations.
+    static const int WinThreshold = WinScore - MaxPly;
+
+    /// Above every score.
+    static const int Infinity = WinScore + 1;
+
+    /// Material values.
+    static const int ManScore = 100;
+    static const int KingScore = 130;
+
+    /// The bonus for each row a man has advanced.
+    static const int AdvanceScore = 2;
+
+    /// How far to search, the search stops at whichever limit it reaches first.
+    struct Limits
+    {
+        Limits() : maxDepth( MaxPly ), maxNodes( 0 ), maxSeconds( 0 ), timeManager( nullptr ) {}
+
+        int maxDepth;
+
+        /// Stop once this many positions have been visited, 0 for no limit.
+        uint64_t maxNodes;
+
+        /// Stop this long after the search started, 0 for no limit.
+        double maxSeconds;
+
+        /// Decides whether to start each iteration and adds its maximum time as a limit. Not owned.
+        TimeManager *timeManager;
+    };
+
+    struct Result
+    {
+        /// The best move of the deepest completed iteration, an empty path when there are no moves.
+        MovePath bestMove;
+        int score;
+
+        /// The deepest completed iteration.
+        int depth;
+
+        /// Positions visited over all the iterations.
+        uint64_t nodes;
+    };
+
+    /// Searches without a transposition table, or with one that outlives the search and can be shared between searches.
+    explicit AlphaBetaSearch( TranspositionTable *transpositionTable = nullptr ) :
+        m_transpositionTable( transpositionTable ),
+        m_stop( nullptr ),
+        m_isUsingTableCutoffs( true ),
+        m_isStopped( false ),
+        m_maxNodes( 0 ),
+        m_hasDeadline( false ),
+        m_nodes( 0 )
+    {}
+
+    /// The search abandons its current iteration once the flag is set, and returns the last one it completed.
+    void SetStopFlag( const std::atomic<bool> *stop ) { m_stop = stop; }
+
+    /// Whether stored scores can decide a position, otherwise the table is only used for the best move.
+    void SetTableCutoffs( bool isUsingTableCutoffs ) { m_isUsingTableCutoffs = isUsingTableCutoffs; }
+
+    /**
+     * Searches one ply deeper each iteration from startDepth up to maxDepth, trying the previous iteration's best
+     * move first. Stops early once a forced win or loss has been found.
+     * If it's stopped before finishing an iteration the best move is the first legal one, with a depth of 0.
+     */
+    Result Search( const CheckersBoard &board, int maxDepth, int startDepth = 1 );
+
+    /// Searches within the limits, starting at startDepth.
+    Result Search( const CheckersBoard &board, const Limits &limits, int startDepth = 1 );
+
+    /// The static score of a position, for the side to move.
+    static int Evaluate( const CheckersBoard &board );
+
+    /// Returns whether a score is a forced win or loss.
+    static bool IsWinScore( int score ) { return score > WinThreshold || score < -WinThreshold; }
+
+private:
+    /// Scores the position to depth plies, ply is the distance from the root.
+    int Negamax( CheckersBoard &board, int depth, int ply, int alpha, int beta );
+
+    /// Checks the stop flag and the limits, the clock only every LimitCheckInterval nodes as reading it is slow.
+    void CheckLimits();
+    bool IsStopped() const { return m_isStopped; }
+
+    static const int LimitCheckInterval = 1024;
+
+    static_assert( MaxPly <= MoveHistory::MaxPly, "Killer moves are kept for every ply" );
+
+    /// Wins are stored as the distance from the stored position, not from the root.
+    static int ToTableScore( int score, int ply ) { return score > WinThreshold ? score + ply : score < -WinThreshold ? score - ply : score; }
+    static int FromTableScore( int score, int ply ) { return score > WinThreshold ? score - ply : score < -WinThreshold ? score + ply : score; }
+
+    TranspositionTable *m_transpositionTable;
+    TranspositionTable::Statistics m_tableStatistics;
+    MoveHistory m_moveHistory;
+    const std::atomic<bool> *m_stop;
+    bool m_isUsingTableCutoffs;
+
+    bool m_isStopped;
+    uint64_t m_maxNodes;
+    bool m_hasDeadline;
+    std::chrono::steady_clock::time_point m_deadline;
+
+    uint64_t m_nodes;
+};
+
+}
@@ -0,0 +1,352 @@
+#include "BatchPlayout.h"
+
+#include "BoardGeometry.h"
+#include "SquareTables.h"
+
+// Define CHECKERS_BATCH_SCALAR to use the scalar kernel on any target.
+#if defined( __BMI2__ )
+#include <immintrin.h>
+#endif
+
+#if defined( CHECKERS_BATCH_SCALAR )
+#elif defined( __AVX2__ )
+#include <immintrin.h>
+#define CHECKERS_BATCH_AVX2
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#include <emmintrin.h>
+#define CHECKERS_BATCH_SSE2
+#endif
+
+using namespace checkers;
+
+namespace {
+
+/// One board per lane, plain 32 bit integers.
+struct ScalarLanes
+{
+    typedef uint32_t Type;
+    static const int Count = 1;
+
+    static Type Load( const uint32_t *p ) { return *p; }
+    static void Store( uint32_t *p, Type v ) { *p = v; }
+    static Type Set( uint32_t v ) { return v; }
+    static Type And( Type a, Type b ) { return a & b; }
+    static Type Or( Type a, Type b ) { return a | b; }
+    static Type AndNot( Type a, Type b ) { return a & ~b; }
+    static Type Not( Type a ) { return ~a; }
+    static Type ShiftLeft( Type a, int n ) { return a << n; }
+    static Type ShiftRight( Type a, int n ) { return a >> n; }
+    static Type IsZero( Type a ) { return a == 0 ? ~0u : 0u; }
+    static bool IsAllZero( Type a ) { return a == 0; }
+    static Type Select( Type mask, Type a, Type b ) { return ( a & mask ) | ( b & ~mask ); }
+};
+
+#if defined( CHECKERS_BATCH_AVX2 )
+
+struct SimdLanes
+{
+    typedef __m256i Type;
+    static const int Count = 8;
+
+    static Type Load( const uint32_t *p ) { return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( p ) ); }
+    static void Store( uint32_t *p, Type v ) { _mm256_storeu_si256( reinterpret_cast<__m256i*>( p ), v ); }
+    static Type Set( uint32_t v ) { return _mm256_set1_epi32( static_cast<int>( v ) ); }
+    static Type And( Type a, Type b ) { return _mm256_and_si256( a, b ); }
+    static Type Or( Type a, Type b ) { return _mm256_or_si256( a, b ); }
+    static Type AndNot( Type a, Type b ) { return _mm256_andnot_si256( b, a ); }
+    static Type Not( Type a ) { return _mm256_xor_si256( a, Set( ~0u ) ); }
+    static Type ShiftLeft( Type a, int n ) { return _mm256_sll_epi32( a, _mm_cvtsi32_si128( n ) ); }
+    static Type ShiftRight( Type a, int n ) { return _mm256_srl_epi32( a, _mm_cvtsi32_si128( n ) ); }
+    static Type IsZero( Type a ) { return _mm256_cmpeq_epi32( a, _mm256_setzero_si256() ); }
+    static bool IsAllZero( Type a ) { return _mm256_testz_si256( a, a ) != 0; }
+    static Type Select( Type mask, Type a, Type b ) { return _mm256_blendv_epi8( b, a, mask ); }
+};
+
+const char *InstructionSet = "AVX2";
+
+#elif defined( CHECKERS_BATCH_SSE2 )
+
+struct SimdLanes
+{
+    typedef __m128i Type;
+    static const int Count = 4;
+
+    static Type Load( const uint32_t *p ) { return _mm_loadu_si128( reinterpret_cast<const __m128i*>( p ) ); }
+    static void Store( uint32_t *p, Type v ) { _mm_storeu_si128( reinterpret_cast<__m128i*>( p ), v ); }
+    static Type Set( uint32_t v ) { return _mm_set1_epi32( static_cast<int>( v ) ); }
+    static Type And( Type a, Type b ) { return _mm_and_si128( a, b ); }
+    static Type Or( Type a, Type b ) { return _mm_or_si128( a, b ); }
+    static Type AndNot( Type a, Type b ) { return _mm_andnot_si128( b, a ); }
+    static Type Not( Type a ) { return _mm_xor_si128( a, Set( ~0u ) ); }
+    static Type ShiftLeft( Type a, int n ) { return _mm_sll_epi32( a, _mm_cvtsi32_si128( n ) ); }
+    static Type ShiftRight( Type a, int n ) { return _mm_srl_epi32( a, _mm_cvtsi32_si128( n ) ); }
+    static Type IsZero( Type a ) { return _mm_cmpeq_epi32( a, _mm_setzero_si128() ); }
+    static bool IsAllZero( Type a ) { return _mm_movemask_epi8( IsZero( a ) ) == 0xFFFF; }
+    static Type Select( Type mask, Type a, Type b ) { return _mm_or_si128( _mm_and_si128( mask, a ), _mm_andnot_si128( mask, b ) ); }
+};
+
+const char *InstructionSet = "SSE2";
+
+#else
+
+typedef ScalarLanes SimdLanes;
+
+const char *InstructionSet = "Scalar";
+
+#endif
+
+/// Geometry8x8::Shift on every lane.
+template<typename L>
+inline typename L::Type ShiftLanes( typename L::Type board, Direction direction )
+{
+    typedef Geometry8x8 G;
+    const int S = G::SquaresPerRow;
+    switch ( direction ) {
+        case Direction::UpRight:
+            return L::Or( L::ShiftLeft( L::And( board, L::Set( G::GetEvenRows() & ~G::GetRightSquares() & ~G::GetLastRow() ) ), S + 1 ),
+                          L::ShiftLeft( L::And( board, L::Set( G::GetOddRows() & ~G::GetLastRow() ) ), S ) );
+        case Direction::UpLeft:
+            return L::Or( L::ShiftLeft( L::And( board, L::Set( G::GetEvenRows() & ~G::GetLastRow() ) ), S ),
+                          L::ShiftLeft( L::And( board, L::Set( G::GetOddRows() & ~G::GetLeftSquares() & ~G::GetLastRow() ) ), S - 1 ) );
+        case Direction::DownRight:
+            return L::Or( L::ShiftRight( L::And( board, L::Set( G::GetEvenRows() & ~G::GetFirstRow() & ~G::GetRightSquares() ) ), S - 1 ),
+                          L::ShiftRight( L::And( board, L::Set( G::GetOddRows() ) ), S ) );
+        default:
+            return L::Or( L::ShiftRight( L::And( board, L::Set( G::GetEvenRows() & ~G::GetFirstRow() ) ), S ),
+                          L::ShiftRight( L::And( board, L::Set( G::GetOddRows() & ~G::GetLeftSquares() ) ), S + 1 ) );
+    }
+}
+
+/// The index of the nth set square of the board.
+inline int SelectSquare( uint32_t board, int n )
+{
+#if defined( __BMI2__ )
+    return LowestSquare( static_cast<uint32_t>( _pdep_u32( 1u << n, board ) ) );
+#else
+    for ( ; n > 0; n-- ) {
+        board &= board - 1;
+    }
+    return LowestSquare( board );
+#endif
+}
+
+/// The landing squares of the jumps the movers can make in each direction, ORed together.
+template<typename L>
+inline typename L::Type GetJumpLandings( typename L::Type upMovers, typename L::Type downMovers,
+                                         typename L::Type opponents, typename L::Type empty )
+{
+    typename L::Type landings = L::Set( 0 );
+    for ( int i = 0; i < NumberOfDirections; i++ ) {
+        Direction direction = static_cast<Direction>( i );
+        typename L::Type movers = i < 2 ? upMovers : downMovers;
+        landings = L::Or( landings, L::And( ShiftLanes<L>( L::And( ShiftLanes<L>( movers, direction ), opponents ), direction ), empty ) );
+    }
+    return landings;
+}
+
+}
+
+const int BatchPlayout::LaneCount = SimdLanes::Count;
+
+const char* BatchPlayout::GetInstructionSet()
+{
+    return InstructionSet;
+}
+
+BatchPlayout::BatchPlayout( int boardCount, uint64_t seed, Kernel kernel ) :
+    m_boardCount( boardCount ),
+    m_kernel( kernel ),
+    m_randomState( seed != 0 ? seed : 1 ),
+    m_totalPlies( 0 )
+{
+    size_t paddedCount = ( boardCount + LaneCount - 1 ) / LaneCount * LaneCount;
+    for ( auto *lanes : { &m_white, &m_black, &m_kings, &m_whiteToMove, &m_continueFrom, &m_active,
+                          &m_hasJump, &m_moved, &m_from, &m_to, &m_captured } ) {
+        lanes->assign( paddedCount, 0 );
+    }
+    for ( auto &destinations : m_destinations ) {
+        destinations.assign( paddedCount, 0 );
+    }
+    m_plies.assign( paddedCount, 0 );
+    m_winners.assign( paddedCount, CheckersBoard::WinType::Draw );
+
+    SetAllBoards( CheckersBoard() );
+}
+
+void BatchPlayout::SetBoard( int index, const CheckersBoard &board )
+{
+    m_white[index] = board.GetPieces( CheckersBoard::SideType::White );
+    m_black[index] = board.GetPieces( CheckersBoard::SideType::Black );
+    m_kings[index] = board.GetKings();
+    m_whiteToMove[index] = board.GetCurrentSide() == CheckersBoard::SideType::White ? ~0u : 0u;
+    m_continueFrom[index] = 0;
+    m_active[index] = ~0u;
+    m_plies[index] = 0;
+    m_winners[index] = CheckersBoard::WinType::Draw;
+}
+
+void BatchPlayout::SetAllBoards( const CheckersBoard &board )
+{
+    for ( int i = 0; i < m_boardCount; i++ ) {
+        SetBoard( i, board );
+    }
+}
+
+CheckersBoard BatchPlayout::GetBoard( int index ) const
+{
+    static const Piece::PieceType EmptyPieceLayout[CheckersBoard::NumberOfSquares] = {};
+    CheckersBoard board( EmptyPieceLayout, m_whiteToMove[index] != 0 ? CheckersBoard::SideType::White : CheckersBoard::SideType::Black );
+    for ( int square = 0; square < NumberOfPlayableSquares; square++ ) {
+        Bitboard mask = SquareMask( square );
+        bool isKing = ( m_kings[index] & mask ) != 0;
+        if ( m_white[index] & mask ) { board.SetPiece( SquareToPos( square ), Piece( Piece::PieceType::White, isKing ) ); }
+        if ( m_black[index] & mask ) { board.SetPiece( SquareToPos( square ), Piece( Piece::PieceType::Black, isKing ) ); }
+    }
+    return board;
+}
+
+uint32_t BatchPlayout::GetRandom( uint32_t count )
+{
+    // xorshift64*, scaled into the range without a division
+    m_randomState ^= m_randomState >> 12;
+    m_randomState ^= m_randomState << 25;
+    m_randomState ^= m_randomState >> 27;
+    uint32_t random = static_cast<uint32_t>( ( m_randomState * 0x2545F4914F6CDD1Dull ) >> 32 );
+    return static_cast<uint32_t>( ( static_cast<uint64_t>( random ) * count ) >> 32 );
+}
+
+int BatchPlayout::Step( int maxPlies )
+{
+    return m_kernel == Kernel::Scalar ? StepLanes<ScalarLanes>( maxPlies ) : StepLanes<SimdLanes>( maxPlies );
+}
+
+template<typename L>
+int BatchPlayout::StepLanes( int maxPlies )
+{
+    typedef typename L::Type LaneType;
+    const LaneType allSquares = L::Set( Geometry8x8::GetAllSquares() );
+    int playingCount = 0;
+
+    for ( int first = 0; first < m_boardCount; first += L::Count ) {
+        // Generate the jump landings, or the step destinations if there are no jumps, in each direction
+        LaneType white = L::Load( &m_white[first] );
+        LaneType black = L::Load( &m_black[first] );
+        LaneType kings = L::Load( &m_kings[first] );
+        LaneType whiteToMove = L::Load( &m_whiteToMove[first] );
+        LaneType continueFrom = L::Load( &m_continueFrom[first] );
+        LaneType active = L::Load( &m_active[first] );
+        if ( L::IsAllZero( active ) ) { continue; }
+
+        LaneType pieces = L::Select( whiteToMove, white, black );
+        LaneType opponents = L::Select( whiteToMove, black, white );
+        LaneType empty = L::AndNot( allSquares, L::Or( white, black ) );
+        LaneType isAnyPiece = L::IsZero( continueFrom );
+        LaneType upMovers = L::And( pieces, L::Or( whiteToMove, kings ) );
+        LaneType downMovers = L::And( pieces, L::Or( L::Not( whiteToMove ), kings ) );
+        LaneType jumpFilter = L::Or( continueFrom, isAnyPiece );
+
+        LaneType jumps[NumberOfDirections];
+        LaneType steps[NumberOfDirections];
+        LaneType anyJump = L::Set( 0 );
+        for ( int i = 0; i < NumberOfDirections; i++ ) {
+            Direction direction = static_cast<Direction>( i );
+            LaneType movers = i < 2 ? upMovers : downMovers;
+            jumps[i] = L::And( ShiftLanes<L>( L::And( ShiftLanes<L>( L::And( movers, jumpFilter ), direction ), opponents ), direction ), empty );
+            steps[i] = L::And( L::And( ShiftLanes<L>( movers, direction ), empty ), isAnyPiece );
+            anyJump = L::Or( anyJump, jumps[i] );
+        }
+
+        LaneType hasJump = L::Not( L::IsZero( anyJump ) );
+        for ( int i = 0; i < NumberOfDirections; i++ ) {
+            L::Store( &m_destinations[i][first], L::And( L::Select( hasJump, jumps[i], steps[i] ), active ) );
+        }
+        L::Store( &m_hasJump[first], hasJump );
+
+        ChooseMoves( first, L::Count, maxPlies );
+
+        // Make the chosen moves
+        LaneType moved = L::Load( &m_moved[first] );
+        LaneType from = L::Load( &m_from[first] );
+        LaneType to = L::Load( &m_to[first] );
+        LaneType captured = L::Load( &m_captured[first] );
+
+        LaneType wasKing = L::Not( L::IsZero( L::And( kings, from ) ) );
+        LaneType kingRow = L::Select( whiteToMove, L::Set( Geometry8x8::GetLastRow() ), L::Set( Geometry8x8::GetFirstRow() ) );
+        LaneType isCrowned = L::AndNot( L::Not( L::IsZero( L::And( to, kingRow ) ) ), wasKing );
+        LaneType newKings = L::Or( L::AndNot( kings, L::Or( from, captured ) ), L::And( to, L::Or( wasKing, kingRow ) ) );
+        LaneType newPieces = L::Or( L::AndNot( pieces, from ), to );
+        LaneType newOpponents = L::AndNot( opponents, captured );
+
+        // The same side moves again if the piece that jumped can jump again. Being crowned ends the move.
+        LaneType jumpedTo = L::AndNot( L::And( to, L::Not( L::IsZero( captured ) ) ), isCrowned );
+        LaneType newEmpty = L::AndNot( allSquares, L::Or( newPieces, newOpponents ) );
+        LaneType continuations = GetJumpLandings<L>( L::And( jumpedTo, L::Or( whiteToMove, newKings ) ),
+                                                    L::And( jumpedTo, L::Or( L::Not( whiteToMove ), newKings ) ),
+                                                    newOpponents, newEmpty );
+        LaneType isContinuing = L::Not( L::IsZero( continuations ) );
+
+        L::Store( &m_white[first], L::Select( moved, L::Select( whiteToMove, newPieces, newOpponents ), white ) );
+        L::Store( &m_black[first], L::Select( moved, L::Select( whiteToMove, newOpponents, newPieces ), black ) );
+        L::Store( &m_kings[first], L::Select( moved, newKings, kings ) );
+        L::Store( &m_whiteToMove[first], L::Select( L::AndNot( moved, isContinuing ), L::Not( whiteToMove ), whiteToMove ) );
+        L::Store( &m_continueFrom[first], L::Select( moved, L::And( to, isContinuing ), continueFrom ) );
+
+        for ( int lane = first; lane < first + L::Count && lane < m_boardCount; lane++ ) {
+            if ( m_active[lane] != 0 ) { playingCount++; }
+        }
+    }
+
+    return playingCount;
+}
+
+void BatchPlayout::ChooseMoves( int firstBoard, int laneCount, int maxPlies )
+{
+    for ( int lane = firstBoard; lane < firstBoard + laneCount; lane++ ) {
+        m_moved[lane] = 0;
+        m_from[lane] = 0;
+        m_to[lane] = 0;
+        m_captured[lane] = 0;
+        if ( lane >= m_boardCount || m_active[lane] == 0 ) { continue; }
+
+        // The number of destinations before each direction
+        int firstChoices[NumberOfDirections + 1];
+        firstChoices[0] = 0;
+        for ( int i = 0; i < NumberOfDirections; i++ ) {
+            firstChoices[i + 1] = firstChoices[i] + PopCount( m_destinations[i][lane] );
+        }
+        int total = firstChoices[NumberOfDirections];
+
+        // The side to move can't move and loses
+        if ( total == 0 ) {
+            m_active[lane] = 0;
+            m_winners[lane] = m_whiteToMove[lane] != 0 ? CheckersBoard::WinType::Black : CheckersBoard::WinType::White;
+            continue;
+        }
+
+        // Find the chosen destination without branching on the random number
+        int choice = static_cast<int>( GetRandom( total ) );
+        int directionIndex = ( choice >= firstChoices[1] ) + ( choice >= firstChoices[2] ) + ( choice >= firstChoices[3] );
+        int to = SelectSquare( m_destinations[directionIndex][lane], choice - firstChoices[directionIndex] );
+
+        Direction direction = static_cast<Direction>( directionIndex );
+        Direction backwards = GetOppositeDirection( direction );
+        bool isJump = m_hasJump[lane] != 0;
+        int from = isJump ? GetJumpSquare( to, backwards ) : GetNeighbourSquare( to, backwards );
+
+        m_moved[lane] = ~0u;
+        m_from[lane] = SquareMask( from );
+        m_to[lane] = SquareMask( to );
+        m_captured[lane] = isJump ? GetNeighbourMask( from, direction ) : 0;
+        m_totalPlies++;
+
+        if ( ++m_plies[lane] >= maxPlies ) {
+            m_active[lane] = 0;
+            m_winners[lane] = CheckersBoard::WinType::Draw;
+        }
+    }
+}
+
+void BatchPlayout::Run( int maxPlies )
+{
+    while ( Step( maxPlies ) > 0 ) {}
+}
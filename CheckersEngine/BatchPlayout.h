@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Bitboard.h"
+#include "CheckersBoard.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace checkers {
+
+/**
+ * Plays random games on many standard boards at once, for Monte Carlo rollouts.
+ * The boards are held as arrays of bitboards, one array per piece set, and every step advances all of them by one
+ * hop in lock step. Move generation, the choice of capture or step and the move itself run on SIMD lanes, one board
+ * per 32 bit lane, with AVX2 or SSE2 when the compiler targets them and plain integers otherwise.
+ * The plain integer kernel can also be chosen at runtime on any target, to check the SIMD kernel against.
+ *
+ * A capture sequence is played one jump per step, the same side moves again while the jumping piece can continue.
+ * A board finishes when the side to move can't move, or as a draw when it reaches the hop limit.
+ */
+class BatchPlayout
+{
+public:
+    /// Which kernel steps the boards.
+    enum class Kernel {
+        /// The SIMD kernel the compiler targets, the scalar one when it targets neither AVX2 nor SSE2.
+        Simd,
+        /// One board at a time on plain integers.
+        Scalar
+    };
+
+    /// Boards are processed in groups of this many, the SIMD width in 32 bit lanes.
+    static const int LaneCount;
+
+    /// The instruction set the kernel was compiled for: "AVX2", "SSE2" or "Scalar".
+    static const char* GetInstructionSet();
+
+    /// Creates boardCount boards, all with the default layout. Both kernels play the same games from the same seed.
+    BatchPlayout( int boardCount, uint64_t seed, Kernel kernel = Kernel::Simd );
+
+    int GetBoardCount() const { return m_boardCount; }
+    Kernel GetKernel() const { return m_kernel; }
+
+    /// Sets one board and restarts its game.
+    void SetBoard( int index, const CheckersBoard &board );
+
+    /// Sets every board to the same position and restarts all the games.
+    void SetAllBoards( const CheckersBoard &board );
+
+    /// The current position of a board. A board part way through a capture sequence has the capturing side to move.
+    CheckersBoard GetBoard( int index ) const;
+
+    bool IsFinished( int index ) const { return m_active[index] == 0; }
+
+    /// The result of a finished board.
+    CheckersBoard::WinType GetWinner( int index ) const { return m_winners[index]; }
+
+    /// The hops played on a board since it was set.
+    int GetPlies( int index ) const { return m_plies[index]; }
+
+    /// The hops played on all the boards since they were created.
+    uint64_t GetTotalPlies() const { return m_totalPlies; }
+
+    /**
+     * Plays one hop on every board that hasn't finished. Boards that reach maxPlies hops finish as draws.
+     * Returns the number of boards still playing.
+     */
+    int Step( int maxPlies );
+
+    /// Steps until every board has finished.
+    void Run( int maxPlies );
+
+private:
+    /// Step on the kernel that works on Lanes.
+    template<typename Lanes>
+    int StepLanes( int maxPlies );
+
+    /// Chooses a random move for each of laneCount boards from the generated destinations.
+    void ChooseMoves( int firstBoard, int laneCount, int maxPlies );
+
+    /// A random number below count.
+    uint32_t GetRandom( uint32_t count );
+
+    int m_boardCount;
+    Kernel m_kernel;
+    uint64_t m_randomState;
+    uint64_t m_totalPlies;
+
+    // One entry per board, padded to a multiple of LaneCount.
+    std::vector<uint32_t> m_white;
+    std::vector<uint32_t> m_black;
+    std::vector<uint32_t> m_kings;
+    std::vector<uint32_t> m_whiteToMove;   // All bits set when white is to move.
+    std::vector<uint32_t> m_continueFrom;  // The square of a piece part way through a capture sequence.
+    std::vector<uint32_t> m_active;        // All bits set while the game is being played.
+
+    // Working state for one step.
+    std::vector<uint32_t> m_destinations[NumberOfDirections];
+    std::vector<uint32_t> m_hasJump;
+    std::vector<uint32_t> m_moved;
+    std::vector<uint32_t> m_from;
+    std::vector<uint32_t> m_to;
+    std::vector<uint32_t> m_captured;
+
+    std::vector<int> m_plies;
+    std::vector<CheckersBoard::WinType> m_winners;
+};
+
+}
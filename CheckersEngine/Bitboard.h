@@ -0,0 +1,97 @@
+#pragma once
+
+#include <assert.h>
+#include <cstdint>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace checkers {
+
+/**
+ * A set of playable squares, one bit per square.
+ * The 32 playable (dark) squares of the standard board are numbered row by row, four to a row: square = row*4 + column/2.
+ * Even rows hold their pieces on the odd columns and odd rows on the even columns.
+ * Larger boards use a 64 bit set, see BoardGeometry.
+ */
+typedef uint32_t Bitboard;
+
+const int NumberOfPlayableSquares = 32;
+
+/// The diagonal directions a piece can move in. Up is towards the higher rows.
+enum class Direction { UpRight, UpLeft, DownRight, DownLeft };
+
+const int NumberOfDirections = 4;
+
+/// Returns a Bitboard with only the given square set.
+inline Bitboard SquareMask( int square )
+{
+    return Bitboard(1) << square;
+}
+
+/// Returns the index of the lowest set square. The board must not be empty.
+inline int LowestSquare( uint32_t board )
+{
+    assert( board != 0 );
+#ifdef _MSC_VER
+    unsigned long square;
+    _BitScanForward( &square, board );
+    return static_cast<int>( square );
+#else
+    return __builtin_ctz( board );
+#endif
+}
+
+inline int LowestSquare( uint64_t board )
+{
+    assert( board != 0 );
+#ifdef _MSC_VER
+    unsigned long square;
+    _BitScanForward64( &square, board );
+    return static_cast<int>( square );
+#else
+    return __builtin_ctzll( board );
+#endif
+}
+
+/// Removes the lowest set square from the board and returns its index.
+template<typename BitboardType>
+inline int PopLowestSquare( BitboardType &board )
+{
+    int square = LowestSquare( board );
+    board &= board - 1;
+    return square;
+}
+
+/// Returns the number of squares set on the board.
+inline int PopCount( uint32_t board )
+{
+#ifdef _MSC_VER
+    return static_cast<int>( __popcnt( board ) );
+#else
+    return __builtin_popcount( board );
+#endif
+}
+
+inline int PopCount( uint64_t board )
+{
+#ifdef _MSC_VER
+    return static_cast<int>( __popcnt64( board ) );
+#else
+    return __builtin_popcountll( board );
+#endif
+}
+
+/// Returns the direction pointing the opposite way.
+inline Direction GetOppositeDirection( Direction direction )
+{
+    switch ( direction ) {
+        case Direction::UpRight: return Direction::DownLeft;
+        case Direction::UpLeft: return Direction::DownRight;
+        case Direction::DownRight: return Direction::UpLeft;
+        default: return Direction::UpRight;
+    }
+}
+
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "Bitboard.h"
+#include "Pos.h"
+
+#include <cstdint>
+
+namespace checkers {
+
+/**
+ * The size of a board and the bitboard type that holds its playable squares, all known at compile time.
+ * The board, its tables and its move generator are templated on a geometry, so each board size gets its own
+ * constant masks and shift distances instead of reading the size at runtime.
+ *
+ * Playable squares are numbered row by row: square = row * SquaresPerRow + column / 2.
+ * Even rows hold their pieces on the odd columns and odd rows on the even columns.
+ *
+ * With FlyingKings set, kings slide any distance along a diagonal and capture a piece anywhere along it.
+ * With MaximumCapture set, a side that can capture must take the most pieces it can.
+ * Men capture forwards only and being crowned ends the move, as on the standard board, unless the international
+ * draughts rules are set: with BackwardManCaptures men capture backwards too, and with CaptureThroughKingRow a man that
+ * reaches the king row part way through a capture carries on capturing as a man, and is only crowned if it ends there.
+ */
+template<int Rows, int Columns, typename BitboardType, int MovePathCapacity, bool FlyingKings = false, bool MaximumCapture = false,
+         bool BackwardManCaptures = false, bool CaptureThroughKingRow = false>
+struct BoardGeometry
+{
+    typedef BitboardType Bitboard;
+
+    static const int NumberOfRows = Rows;
+    static const int NumberOfColumns = Columns;
+    static const int NumberOfSquares = Rows * Columns;
+    static const int SquaresPerRow = Columns / 2;
+    static const int NumberOfPlayableSquares = Rows * SquaresPerRow;
+    static const bool HasFlyingKings = FlyingKings;
+    static const bool HasMaximumCapture = MaximumCapture;
+    static const bool HasBackwardManCaptures = BackwardManCaptures;
+    static const bool HasCaptureThroughKingRow = CaptureThroughKingRow;
+
+    /// The most squares a piece can slide past along one diagonal.
+    static const int MaxRayLength = ( Rows < Columns ? Rows : Columns ) - 1;
+
+    /// Each side starts with its men on every playable square of this many rows.
+    static const int StartingRows = Rows / 2 - 1;
+    static const int NumberOfStartingPieces = StartingRows * SquaresPerRow;
+
+    /// Each piece can make at most 4 single steps or 4 single jumps, a flying king can reach two whole diagonals.
+    static const int MaxMoves = NumberOfStartingPieces * ( FlyingKings ? 2 * MaxRayLength : NumberOfDirections );
+
+    /**
+     * Complete moves kept inline. Simple moves are bounded by MaxMoves, but capture sequences branch too much for a
+     * useful bound, positions with more of them grow the list onto the heap.
+     */
+    static const int MaxMovePaths = MovePathCapacity;
+
+    static_assert( Rows % 2 == 0 && Columns % 2 == 0, "Rows and columns come in pairs" );
+    static_assert( sizeof( Bitboard ) * 8 >= NumberOfPlayableSquares, "The bitboard holds every playable square" );
+    static_assert( MaxMovePaths >= MaxMoves, "Positions without a capture never leave the inline move paths" );
+
+    static constexpr int GetRow( int square ) { return square / SquaresPerRow; }
+    static constexpr int GetColumn( int square ) { return ( square % SquaresPerRow ) * 2 + ( GetRow( square ) % 2 == 0 ? 1 : 0 ); }
+
+    /// The square at the row and column, or -1 if it's off the board.
+    static constexpr int GetSquare( int row, int column )
+    {
+        return ( row < 0 || row >= Rows || column < 0 || column >= Columns ) ? -1 : row * SquaresPerRow + column / 2;
+    }
+
+    /// The mask of a square, 0 for -1.
+    static constexpr Bitboard GetSquareMask( int square ) { return square < 0 ? 0 : Bitboard( 1 ) << square; }
+
+    /// All the playable squares.
+    static constexpr Bitboard GetAllSquares() { return ~Bitboard( 0 ) >> ( sizeof( Bitboard ) * 8 - NumberOfPlayableSquares ); }
+
+    /// All the squares of a row.
+    static constexpr Bitboard GetRowMask( int row ) { return ( ( Bitboard( 1 ) << SquaresPerRow ) - 1 ) << ( row * SquaresPerRow ); }
+
+    /// All the squares of count rows, starting at firstRow.
+    static constexpr Bitboard GetRowsMask( int firstRow, int count )
+    {
+        return count == 0 ? 0 : GetRowMask( firstRow ) | GetRowsMask( firstRow + 1, count - 1 );
+    }
+
+    /// The squares of every second row, starting at row.
+    static constexpr Bitboard GetAlternateRowsMask( int row )
+    {
+        return row >= Rows ? 0 : GetRowMask( row ) | GetAlternateRowsMask( row + 2 );
+    }
+
+    /// The square at the same index in every row.
+    static constexpr Bitboard GetColumnSquaresMask( int index, int row = 0 )
+    {
+        return row >= Rows ? 0 : GetSquareMask( row * SquaresPerRow + index ) | GetColumnSquaresMask( index, row + 1 );
+    }
+
+    static constexpr Bitboard GetEvenRows() { return GetAlternateRowsMask( 0 ); }
+    static constexpr Bitboard GetOddRows() { return GetAlternateRowsMask( 1 ); }
+    static constexpr Bitboard GetFirstRow() { return GetRowMask( 0 ); }
+    static constexpr Bitboard GetLastRow() { return GetRowMask( Rows - 1 ); }
+    static constexpr Bitboard GetLeftSquares() { return GetColumnSquaresMask( 0 ); }
+    static constexpr Bitboard GetRightSquares() { return GetColumnSquaresMask( SquaresPerRow - 1 ); }
+
+    /// The squares on the edge of the board. A piece on them can never be jumped.
+    static constexpr Bitboard GetEdgeSquares()
+    {
+        return GetFirstRow() | GetLastRow() | ( GetLeftSquares() & GetOddRows() ) | ( GetRightSquares() & GetEvenRows() );
+    }
+
+    /// Convert a playable Pos into a square index.
+    static int PosToSquare( const Pos &pos ) { return pos.row * SquaresPerRow + pos.column / 2; }
+
+    /// Convert a square index back into a Pos.
+    static Pos SquareToPos( int square ) { return { GetRow( square ), GetColumn( square ) }; }
+
+    /**
+     * Moves every square on the board one diagonal step in the given direction.
+     * Squares that would step off the board are dropped.
+     * The shift distance depends on the row parity, so even and odd rows are shifted separately.
+     */
+    static Bitboard Shift( Bitboard board, Direction direction )
+    {
+        const int S = SquaresPerRow;
+        switch ( direction ) {
+            case Direction::UpRight:
+                return ( ( board & GetEvenRows() & ~GetRightSquares() & ~GetLastRow() ) << ( S + 1 ) ) |
+                       ( ( board & GetOddRows() & ~GetLastRow() ) << S );
+            case Direction::UpLeft:
+                return ( ( board & GetEvenRows() & ~GetLastRow() ) << S ) |
+                       ( ( board & GetOddRows() & ~GetLeftSquares() & ~GetLastRow() ) << ( S - 1 ) );
+            case Direction::DownRight:
+                return ( ( board & GetEvenRows() & ~GetFirstRow() & ~GetRightSquares() ) >> ( S - 1 ) ) |
+                       ( ( board & GetOddRows() ) >> S );
+            default:
+                return ( ( board & GetEvenRows() & ~GetFirstRow() ) >> S ) |
+                       ( ( board & GetOddRows() & ~GetLeftSquares() ) >> ( S + 1 ) );
+        }
+    }
+};
+
+template<int R, int C, typename B, int M, bool F, bool X, bool BC, bool TK> const int BoardGeometry<R, C, B, M, F, X, BC, TK>::NumberOfRows;
+template<int R, int C, typename B, int M, bool F, bool X, bool BC, bool TK> const int BoardGeometry<R, C, B, M, F, X, BC, TK>::NumberOfColumns;
+template<int R, int C, typename B, int M, bool F, bool X, bool BC, bool TK> const int BoardGeometry<R, C, B, M, F, X, BC, TK>::NumberOfSquares;
+template<int R, int C, typename B, int M, bool F, bool X, bool BC, bool TK> const int BoardGeometry<R, C, B, M, F, X, BC, TK>::SquaresPerRow;
+template<int R, int C, typename B, int M, bool F, bool X, bool BC, bool TK> const int BoardGeometry<R, C, B, M, F, X, BC, TK>::NumberOfPlayableSquares;
+template<int R, int C, typename B, int M, bool F, bool X, bool BC, bool TK> const bool BoardGeometry<R, C, B, M, F, X, BC, TK>::HasFlyingKings;
+template<int R, int C, typename B, int M, bool F, bool X, bool BC, bool TK> const bool BoardGeometry<R, C, B, M, F, X, BC, TK>::HasMaximumCapture;
+template<int R, int C, typename B, int M, bool F, bool X, bool BC, bool TK> const bool BoardGeometry<R, C, B, M, F, X, BC, TK>::HasBackwardManCaptures;
+template<int R, int C, typename B, int M, bool F, bool X, bool BC, bool TK> const bool BoardGeometry<R, C, B, M, F, X, BC, TK>::HasCaptureThroughKingRow;
+template<int R, int C, typename B, int M, bool F, bool X, bool BC, bool TK> const int BoardGeometry<R, C, B, M, F, X, BC, TK>::MaxRayLength;
+template<int R, int C, typename B, int M, bool F, bool X, bool BC, bool TK> const int BoardGeometry<R, C, B, M, F, X, BC, TK>::StartingRows;
+template<int R, int C, typename B, int M, bool F, bool X, bool BC, bool TK> const int BoardGeometry<R, C, B, M, F, X, BC, TK>::NumberOfStartingPieces;
+template<int R, int C, typename B, int M, bool F, bool X, bool BC, bool TK> const int BoardGeometry<R, C, B, M, F, X, BC, TK>::MaxMoves;
+template<int R, int C, typename B, int M, bool F, bool X, bool BC, bool TK> const int BoardGeometry<R, C, B, M, F, X, BC, TK>::MaxMovePaths;
+
+/// The standard 8x8 checkers board, 32 playable squares.
+typedef BoardGeometry<8, 8, Bitboard, 128> Geometry8x8;
+
+/// The 10x10 international draughts board, 50 playable squares.
+typedef BoardGeometry<10, 10, uint64_t, 256> Geometry10x10;
+
+/// The standard board with flying kings, with men as on the standard board. Flying captures branch more, so more room for moves.
+typedef BoardGeometry<8, 8, Bitboard, 256, true> Geometry8x8FlyingKings;
+
+/// The 10x10 board with flying kings, with men as on the standard board.
+typedef BoardGeometry<10, 10, uint64_t, 512, true> Geometry10x10FlyingKings;
+
+/// The 10x10 board with the international draughts rules: flying kings, the maximum capture rule, and men that capture
+/// backwards and through the king row.
+typedef BoardGeometry<10, 10, uint64_t, 512, true, true, true, true> Geometry10x10MaximumCapture;
+
+static_assert( Geometry8x8::NumberOfPlayableSquares == NumberOfPlayableSquares, "Bitboard matches the standard board" );
+static_assert( Geometry8x8::GetEvenRows() == 0x0F0F0F0F && Geometry8x8::GetRightSquares() == 0x88888888, "Standard board masks" );
+static_assert( Geometry10x10::GetAllSquares() == 0x3FFFFFFFFFFFFull, "Draughts board has 50 squares" );
+static_assert( Geometry8x8::GetEdgeSquares() == 0xF818181F, "Standard board edge" );
+
+/// Convert a playable Pos on the standard board into a square index.
+inline int PosToSquare( const Pos &pos )
+{
+    return Geometry8x8::PosToSquare( pos );
+}
+
+/// Convert a square index on the standard board back into a Pos.
+inline Pos SquareToPos( int square )
+{
+    return Geometry8x8::SquareToPos( square );
+}
+
+/// Moves every square of a standard board one diagonal step in the given direction.
+inline Bitboard ShiftBoard( Bitboard board, Direction direction )
+{
+    return Geometry8x8::Shift( board, direction );
+}
+
+}
@@ -1,167 +1,684 @@
 #include "CheckersBoard.h"
 
 #include <algorithm>
-#include <cstring> // For memcpy
+#include <stdexcept>
 
 using namespace checkers;
 
 using PieceType = checkers::Piece::PieceType;
 
-const Piece::PieceType CheckersBoard::DefaultPieceLayout[NumberOfSquares] = {
-    PieceType::None,  PieceType::White, PieceType::None,  PieceType::White, PieceType::None,  PieceType::White, PieceType::None,  PieceType::White,
-    PieceType::White, PieceType::None,  PieceType::White, PieceType::None,  PieceType::White, PieceType::None,  PieceType::White, PieceType::None,
-    PieceType::None,  PieceType::White, PieceType::None,  PieceType::White, PieceType::None,  PieceType::White, PieceType::None,  PieceType::White,
-    PieceType::None,  PieceType::None,  PieceType::None,  PieceType::None,  PieceType::None,  PieceType::None,  PieceType::None,  PieceType::None,
-    PieceType::None,  PieceType::None,  PieceType::None,  PieceType::None,  PieceType::None,  PieceType::None,  PieceType::None,  PieceType::None,
-    PieceType::Black, PieceType::None,  PieceType::Black, PieceType::None,  PieceType::Black, PieceType::None,  PieceType::Black, PieceType::None,
-    PieceType::None,  PieceType::Black, PieceType::None,  PieceType::Black, PieceType::None,  PieceType::Black, PieceType::None,  PieceType::Black,
-    PieceType::Black, PieceType::None,  PieceType::Black, PieceType::None,  PieceType::Black, PieceType::None,  PieceType::Black, PieceType::None
-};
+template<typename Geometry>
+BasicCheckersBoard<Geometry>::BasicCheckersBoard() :
+    m_currentSide( SideType::White ),
+    m_whitePieces( Geometry::GetRowsMask( 0, Geometry::StartingRows ) ),
+    m_blackPieces( Geometry::GetRowsMask( NumberOfRows - Geometry::StartingRows, Geometry::StartingRows ) ),
+    m_kings( 0 ),
+    m_hash( 0 ),
+    m_capturedPieces( 0 ),
+    m_capturingPiece( 0 ),
+    m_jumpers( 0 ),
+    m_isJumpersValid( false )
+{
+    m_hash = ComputeHash();
+}
 
-CheckersBoard::CheckersBoard( const PieceType pieceTypes[NumberOfSquares], SideType startSide ) :
-    m_currentSide( startSide )
+template<typename Geometry>
+BasicCheckersBoard<Geometry>::BasicCheckersBoard( const PieceType pieceTypes[NumberOfSquares], SideType startSide ) :
+    m_currentSide( startSide ),
+    m_whitePieces( 0 ),
+    m_blackPieces( 0 ),
+    m_kings( 0 ),
+    m_hash( startSide == SideType::Black ? Zobrist::GetSideKey() : 0 ),
+    m_capturedPieces( 0 ),
+    m_capturingPiece( 0 ),
+    m_jumpers( 0 ),
+    m_isJumpersValid( false )
 {
     for( int i=0; i<NumberOfSquares; i++ )
     {
-        m_pieces[i] = Piece(pieceTypes[i], false);
+        Pos pos{ i / NumberOfColumns, i % NumberOfColumns };
+        SetPiece( pos, Piece(pieceTypes[i], false) );
     }
 }
 
-CheckersBoard::CheckersBoard(const CheckersBoard& board)
+template<typename Geometry>
+uint64_t BasicCheckersBoard<Geometry>::ComputeHash() const
+{
+	uint64_t hash = m_currentSide == SideType::Black ? Zobrist::GetSideKey() : 0;
+	hash ^= Zobrist::GetPiecesKey(true, false, m_whitePieces & ~m_kings);
+	hash ^= Zobrist::GetPiecesKey(true, true, m_whitePieces & m_kings);
+	hash ^= Zobrist::GetPiecesKey(false, false, m_blackPieces & ~m_kings);
+	hash ^= Zobrist::GetPiecesKey(false, true, m_blackPieces & m_kings);
+	return hash;
+}
+
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::GetMoves(MoveList &moves) const
+{
+	// If there are jump moves, we have to do them first.
+	Bitboard jumpers = GetJumpers();
+	if (jumpers != 0) {
+		AddJumpMoves(jumpers, moves);
+		RemoveShorterCaptures(moves);
+		return;
+	}
+
+	AddSimpleMoves(GetCurrentPieces(), moves);
+}
+
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::GetMoves(const Pos &pos, MoveList &moves) const
+{
+	if (!IsPlayable(pos)) return;
+	AddSimpleMoves(GetCurrentPieces() & Geometry::GetSquareMask(Geometry::PosToSquare(pos)), moves);
+}
+
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::GetJumpMoves( MoveList &jumpMoves ) const
+{
+    AddJumpMoves( GetJumpers(), jumpMoves );
+    RemoveShorterCaptures( jumpMoves );
+}
+
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::GetJumpMoves( const Pos &startPos, MoveList &jumpMoves ) const
+{
+    if ( !IsPlayable( startPos ) ) return;
+    AddJumpMoves( GetJumpers() & Geometry::GetSquareMask( Geometry::PosToSquare( startPos ) ), jumpMoves );
+    RemoveShorterCaptures( jumpMoves );
+}
+
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::GetMovePaths( MovePathList &movePaths ) const
 {
-	memcpy(m_pieces, board.m_pieces, sizeof(m_pieces));
-	m_currentSide = board.m_currentSide;
+    Bitboard jumpers = GetJumpers();
+    if ( jumpers != 0 && Geometry::HasMaximumCapture ) {
+        AddMaximumCaptures( jumpers, movePaths );
+        return;
+    }
+
+    if ( jumpers != 0 ) {
+        // The moving piece has left its square, so it may pass back over it.
+        Bitboard empty = GetEmptySquares();
+        while ( jumpers != 0 ) {
+            int square = PopLowestSquare( jumpers );
+            MovePath movePath{};
+            movePath.AddSquare( square );
+            AddCaptureSequences( movePath, ( m_kings & Geometry::GetSquareMask( square ) ) != 0, empty | Geometry::GetSquareMask( square ), movePaths );
+        }
+        return;
+    }
+
+    Bitboard empty = GetEmptySquares();
+    Bitboard flyingKings = GetFlyingKings( GetCurrentPieces() );
+    Bitboard pieces = GetCurrentPieces() & ~flyingKings;
+    for ( int i = 0; i < NumberOfDirections; i++ ) {
+        Direction direction = static_cast<Direction>( i );
+        Direction backwards = GetOppositeDirection( direction );
+        Bitboard destinations = Geometry::Shift( GetMovers( pieces, direction ), direction ) & empty;
+        while ( destinations != 0 ) {
+            int to = PopLowestSquare( destinations );
+            MovePath movePath{};
+            movePath.AddSquare( Tables::GetNeighbourSquare( to, backwards ) );
+            movePath.AddSquare( to );
+            movePaths.push_back( movePath );
+        }
+    }
+
+    while ( flyingKings != 0 ) {
+        int from = PopLowestSquare( flyingKings );
+        for ( int i = 0; i < NumberOfDirections; i++ ) {
+            Bitboard destinations = Rays::GetSlides( Geometry::GetSquareMask( from ), empty, static_cast<Direction>( i ) );
+            while ( destinations != 0 ) {
+                MovePath movePath{};
+                movePath.AddSquare( from );
+                movePath.AddSquare( PopLowestSquare( destinations ) );
+                movePaths.push_back( movePath );
+            }
+        }
+    }
 }
 
-void CheckersBoard::GetMoves(std::vector<Move> &moves) const
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::AddCaptureSequences(MovePath &movePath, bool isKing, Bitboard empty, MovePathList &movePaths) const
 {
-	int currentMoveCount = moves.size();
-	for (int row = 0; row < NumberOfRows; row++) {
-		for (int column = 0; column < NumberOfColumns; column++) {
-			Pos startPos{ row, column };
-			GetJumpMoves(startPos, moves);
+	int square = movePath.GetTo();
+	Bitboard opponentPieces = GetOpponentPieces() & ~movePath.captured; // A piece can only be captured once
+	bool isComplete = true;
+
+	// Captured pieces stay on the board until the move is over, so they block the rays of a flying king.
+	if (Geometry::HasFlyingKings && isKing) {
+		Bitboard squareMask = Geometry::GetSquareMask(square);
+		for (int i = 0; i < NumberOfDirections; i++) {
+			Direction direction = static_cast<Direction>(i);
+			Bitboard jumped = Rays::GetCaptureTargets(squareMask, empty, opponentPieces, direction);
+			Bitboard landings = Rays::GetCaptureLandings(squareMask, empty, opponentPieces, direction);
+			while (landings != 0) {
+				isComplete = false;
+				MovePath nextPath = movePath;
+				nextPath.AddSquare(PopLowestSquare(landings));
+				nextPath.captured |= jumped;
+				AddCaptureSequences(nextPath, isKing, empty, movePaths);
+			}
+		}
+
+		if (isComplete && movePath.IsCapture()) {
+			movePaths.push_back(movePath);
 		}
+		return;
 	}
 
-	// If there are jump moves, we have to do them first.
-	if (currentMoveCount != moves.size()) return;
+	for (int i = 0; i < NumberOfDirections; i++) {
+		Direction direction = static_cast<Direction>(i);
+		if (!IsCaptureDirection(isKing, direction)) continue;
+
+		Bitboard jumped = Tables::GetNeighbourMask(square, direction) & opponentPieces;
+		Bitboard landing = Tables::GetJumpMask(square, direction) & empty;
+		if (jumped == 0 || landing == 0) continue;
+
+		isComplete = false;
+		MovePath nextPath = movePath;
+		nextPath.AddSquare(Tables::GetJumpSquare(square, direction));
+		nextPath.captured |= jumped;
+
+		if (!isKing && !Geometry::HasCaptureThroughKingRow && (landing & GetKingRow()) != 0) {
+			movePaths.push_back(nextPath); // Being crowned ends the move
+		}
+		else {
+			AddCaptureSequences(nextPath, isKing, empty, movePaths);
+		}
+	}
 
-	for (int row = 0; row < NumberOfRows; row++) {
-		for (int column = 0; column < NumberOfColumns; column++) {
-			Pos startPos{ row, column };
-			GetMoves(startPos, moves); 
+	if (isComplete && movePath.IsCapture()) {
+		movePaths.push_back(movePath);
+	}
+}
+
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::AddMaximumCaptures(Bitboard jumpers, MovePathList &movePaths) const
+{
+	CaptureSearch search{};
+	search.capturable = GetOpponentPieces() & ~Geometry::GetEdgeSquares();
+	search.best = 1;
+	search.firstPath = movePaths.size();
+
+	while (jumpers != 0) {
+		int square = PopLowestSquare(jumpers);
+		search.path = MovePath{};
+		search.path.AddSquare(square);
+		search.isKing = (m_kings & Geometry::GetSquareMask(square)) != 0;
+		search.empty = GetEmptySquares() | Geometry::GetSquareMask(square); // The moving piece may pass back over its square
+		SearchMaximumCaptures(search, movePaths);
+	}
+}
+
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::SearchMaximumCaptures(CaptureSearch &search, MovePathList &movePaths) const
+{
+	MovePath &path = search.path;
+	if (PopCount(path.captured) + PopCount(search.capturable & ~path.captured) < search.best) return;
+
+	int square = path.GetTo();
+	Bitboard squareMask = Geometry::GetSquareMask(square);
+	Bitboard opponentPieces = GetOpponentPieces() & ~path.captured; // A piece can only be captured once
+	bool isFlying = Geometry::HasFlyingKings && search.isKing;
+	bool isComplete = true;
+
+	for (int i = 0; i < NumberOfDirections; i++) {
+		Direction direction = static_cast<Direction>(i);
+		if (!IsCaptureDirection(search.isKing, direction)) continue;
+
+		Bitboard jumped, landings;
+		if (isFlying) {
+			jumped = Rays::GetCaptureTargets(squareMask, search.empty, opponentPieces, direction);
+			landings = Rays::GetCaptureLandings(squareMask, search.empty, opponentPieces, direction);
+		}
+		else {
+			jumped = Tables::GetNeighbourMask(square, direction) & opponentPieces;
+			landings = jumped != 0 ? Tables::GetJumpMask(square, direction) & search.empty : 0;
+		}
+
+		while (landings != 0) {
+			isComplete = false;
+			int landing = PopLowestSquare(landings);
+			path.AddSquare(landing);
+			path.captured |= jumped;
+
+			if (!search.isKing && !Geometry::HasCaptureThroughKingRow && (Geometry::GetSquareMask(landing) & GetKingRow()) != 0) {
+				AddMaximumCapture(search, movePaths); // Being crowned ends the move
+			}
+			else {
+				SearchMaximumCaptures(search, movePaths);
+			}
+
+			path.captured &= ~jumped;
+			path.RemoveLastSquare();
+		}
+	}
+
+	if (isComplete && path.IsCapture()) {
+		AddMaximumCapture(search, movePaths);
+	}
+}
+
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::AddMaximumCapture(CaptureSearch &search, MovePathList &movePaths) const
+{
+	int count = PopCount(search.path.captured);
+	if (count < search.best) return;
+	if (count > search.best) {
+		search.best = count;
+		while (movePaths.size() > search.firstPath) movePaths.pop_back();
+	}
+
+	for (int i = search.firstPath; i < movePaths.size(); i++) {
+		if (movePaths[i].IsSameMove(search.path)) return;
+	}
+	movePaths.push_back(search.path);
+}
+
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::RemoveShorterCaptures(MoveList &moves) const
+{
+	if (!Geometry::HasMaximumCapture || moves.empty()) return;
+
+	MovePathList movePaths;
+	GetMovePaths(movePaths);
+
+	int count = 0;
+	for (int i = 0; i < moves.size(); i++) {
+		bool isLongest = false;
+		for (auto &movePath : movePaths) {
+			isLongest |= movePath.squares[0] == moves[i].GetFrom() && movePath.squares[1] == moves[i].GetTo();
 		}
+		if (isLongest) moves[count++] = moves[i];
 	}
+	while (moves.size() > count) moves.pop_back();
 }
 
-void CheckersBoard::GetMoves(const Pos &pos, std::vector<Move> &moves) const
+template<typename Geometry>
+bool BasicCheckersBoard<Geometry>::IsForward(Direction direction) const
 {
-	static const Pos moveDeltas[4] { Pos{ 1, 1 }, Pos{ -1, 1 }, Pos{ -1, -1 }, Pos{ 1, -1 } };
-	GetMoves(pos, moveDeltas, moves);
+	bool isUp = direction == Direction::UpRight || direction == Direction::UpLeft;
+	return isUp == (GetCurrentSide() == SideType::White);
 }
 
-void CheckersBoard::GetJumpMoves( std::vector<Move> &jumpMoves ) const
+template<typename Geometry>
+typename BasicCheckersBoard<Geometry>::Bitboard BasicCheckersBoard<Geometry>::GetMovers(Bitboard pieces, Direction direction) const
 {
-    for ( int row = 0; row < NumberOfRows; row++ ) {
-        for ( int column = 0; column < NumberOfColumns; column++ ) {
-            Pos startPos{ row, column };
-            GetJumpMoves( startPos, jumpMoves );
-        }
-    }
+	return IsForward(direction) ? pieces : pieces & m_kings;
+}
+
+template<typename Geometry>
+typename BasicCheckersBoard<Geometry>::Bitboard BasicCheckersBoard<Geometry>::ComputeJumpers() const
+{
+	Bitboard flyingKings = GetFlyingKings(GetCurrentPieces());
+	Bitboard pieces = GetCurrentPieces() & ~flyingKings;
+	Bitboard opponentPieces = GetOpponentPieces();
+	Bitboard empty = GetEmptySquares();
+
+	// Walk backwards from the empty landing squares, over an opponent, to the jumping piece.
+	Bitboard jumpers = 0;
+	for (int i = 0; i < NumberOfDirections; i++) {
+		Direction direction = static_cast<Direction>(i);
+		Direction backwards = GetOppositeDirection(direction);
+		Bitboard jumpedSquares = Geometry::Shift(empty, backwards) & opponentPieces;
+		jumpers |= Geometry::Shift(jumpedSquares, backwards) & GetCapturingPieces(pieces, direction);
+		if (flyingKings != 0) {
+			jumpers |= Rays::GetCapturers(flyingKings, empty, opponentPieces, direction);
+		}
+	}
+
+	// Part way through a capture sequence only the capturing piece can jump.
+	return m_capturedPieces != 0 ? jumpers & m_capturingPiece : jumpers;
+}
+
+template<typename Geometry>
+bool BasicCheckersBoard<Geometry>::HasMoves() const
+{
+	if (GetJumpers() != 0) return true;
+
+	Bitboard pieces = GetCurrentPieces();
+	Bitboard empty = GetEmptySquares();
+	for (int i = 0; i < NumberOfDirections; i++) {
+		Direction direction = static_cast<Direction>(i);
+		if ((Geometry::Shift(GetMovers(pieces, direction), direction) & empty) != 0) return true;
+	}
+	return false;
+}
+
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::AddSimpleMoves(Bitboard pieces, MoveList &moves) const
+{
+	Bitboard empty = GetEmptySquares();
+	Bitboard flyingKings = GetFlyingKings(pieces);
+	pieces &= ~flyingKings;
+	while (flyingKings != 0) {
+		AddKingSlides(PopLowestSquare(flyingKings), moves);
+	}
+
+	for (int i = 0; i < NumberOfDirections; i++) {
+		Direction direction = static_cast<Direction>(i);
+		Direction backwards = GetOppositeDirection(direction);
+		Bitboard destinations = Geometry::Shift(GetMovers(pieces, direction), direction) & empty;
+		while (destinations != 0) {
+			int to = PopLowestSquare(destinations);
+			int from = Tables::GetNeighbourSquare(to, backwards);
+			moves.push_back(PackedMove(from, to, direction, false));
+		}
+	}
 }
 
-void CheckersBoard::GetJumpMoves( const Pos &startPos, std::vector<Move> &jumpMoves ) const
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::AddJumpMoves(Bitboard pieces, MoveList &moves) const
 {
-    static const Pos jumpDeltas[4] { Pos{ 2, 2 }, Pos{ -2, 2 }, Pos{ -2, -2 }, Pos{ 2, -2 } };
-	GetMoves(startPos, jumpDeltas, jumpMoves);
+	Bitboard opponentPieces = GetOpponentPieces();
+	Bitboard empty = GetEmptySquares();
+
+	Bitboard flyingKings = GetFlyingKings(pieces);
+	pieces &= ~flyingKings;
+	while (flyingKings != 0) {
+		int from = PopLowestSquare(flyingKings);
+		for (int i = 0; i < NumberOfDirections; i++) {
+			Direction direction = static_cast<Direction>(i);
+			Bitboard destinations = Rays::GetCaptureLandings(Geometry::GetSquareMask(from), empty, opponentPieces, direction);
+			while (destinations != 0) {
+				moves.push_back(PackedMove(from, PopLowestSquare(destinations), direction, true));
+			}
+		}
+	}
+
+	for (int i = 0; i < NumberOfDirections; i++) {
+		Direction direction = static_cast<Direction>(i);
+		Direction backwards = GetOppositeDirection(direction);
+		Bitboard jumpedSquares = Geometry::Shift(GetCapturingPieces(pieces, direction), direction) & opponentPieces;
+		Bitboard destinations = Geometry::Shift(jumpedSquares, direction) & empty;
+		while (destinations != 0) {
+			int to = PopLowestSquare(destinations);
+			int from = Tables::GetJumpSquare(to, backwards);
+			moves.push_back(PackedMove(from, to, direction, true));
+		}
+	}
 }
 
-void CheckersBoard::GetMoves(const Pos &startPos, const Pos moveDeltas[4], std::vector<Move> &moves) const
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::AddKingSlides(int from, MoveList &moves) const
 {
-	for (int i = 0; i < 4; i++) {
-		auto moveDelta = moveDeltas[i];
-		Move move{ startPos, startPos + moveDelta };
-		if (GetMoveError_DontForceJumps(move) == MoveError::None) {
-			moves.push_back(move);
+	Bitboard empty = GetEmptySquares();
+	for (int i = 0; i < NumberOfDirections; i++) {
+		Direction direction = static_cast<Direction>(i);
+		Bitboard destinations = Rays::GetSlides(Geometry::GetSquareMask(from), empty, direction);
+		while (destinations != 0) {
+			moves.push_back(PackedMove(from, PopLowestSquare(destinations), direction, false));
 		}
 	}
 }
 
-CheckersBoard::MoveError CheckersBoard::GetMoveError( const checkers::Move &move ) const
+template<typename Geometry>
+int BasicCheckersBoard<Geometry>::GetJumpedSquare(const PackedMove &move) const
+{
+	if (!Geometry::HasFlyingKings) return move.GetJumpedSquare<Geometry>();
+	return LowestSquare(Rays::GetFirstBlockers(Geometry::GetSquareMask(move.GetFrom()), GetEmptySquares(), move.GetDirection()));
+}
+
+template<typename Geometry>
+PackedMove BasicCheckersBoard<Geometry>::ToPackedMove(const Move &move) const
+{
+	PackedMove packedMove = PackedMove::FromMove<Geometry>(move);
+	if (!Geometry::HasFlyingKings) return packedMove;
+
+	// Sliding only crosses empty squares, anything else passes over a piece.
+	Bitboard slides = Rays::GetSlides(Geometry::GetSquareMask(packedMove.GetFrom()), GetEmptySquares(), packedMove.GetDirection());
+	bool isJump = (slides & Geometry::GetSquareMask(packedMove.GetTo())) == 0;
+	return PackedMove(packedMove.GetFrom(), packedMove.GetTo(), packedMove.GetDirection(), isJump);
+}
+
+template<typename Geometry>
+typename BasicCheckersBoard<Geometry>::MoveError BasicCheckersBoard<Geometry>::GetMoveError( const checkers::Move &move ) const
 {
     auto moveError = GetMoveError_DontForceJumps( move );
-    if ( moveError == MoveError::None ) {
-        // Check the available jump separately to the move errors to avoid recursion
-        std::vector<Move> jumpMoves;
+
+    // A move without errors that is a jump is one of the available jumps, a step is only allowed if there are none
+    PackedMove packedMove = moveError == MoveError::None ? ToPackedMove( move ) : PackedMove();
+    if ( moveError == MoveError::None && !packedMove.IsJump() && GetJumpers() != 0 ) {
+        return MoveError::MustJump;
+    }
+
+    // Part way through a capture sequence, it's the capturing piece that has to carry on
+    if ( moveError == MoveError::None && m_capturedPieces != 0 && ( Geometry::GetSquareMask( packedMove.GetFrom() ) & m_capturingPiece ) == 0 ) {
+        return MoveError::MustContinueCapture;
+    }
+
+    // And with the maximum capture rule, the jump has to start one of the longest capture sequences
+    if ( Geometry::HasMaximumCapture && packedMove.IsJump() ) {
+        MoveList jumpMoves;
         GetJumpMoves( jumpMoves );
-        if ( jumpMoves.size() > 0 && std::find( jumpMoves.begin(), jumpMoves.end(), move ) == jumpMoves.end() ) {
-            return MoveError::MustJump;
-        }
+        if ( std::find( jumpMoves.begin(), jumpMoves.end(), packedMove ) == jumpMoves.end() ) { return MoveError::NotMaximumCapture; }
     }
     return moveError;
 }
 
-CheckersBoard::MoveError CheckersBoard::GetMoveError_DontForceJumps( const checkers::Move &move ) const
+template<typename Geometry>
+typename BasicCheckersBoard<Geometry>::MoveError BasicCheckersBoard<Geometry>::GetMoveError_DontForceJumps( const checkers::Move &move ) const
 {
     // Basic checks
-    if ( !IsOccupied( move.from ) ) { return MoveError::NoPieceToMove; }
+    if ( !IsPlayable( move.from ) || !IsOccupied( move.from ) ) { return MoveError::NoPieceToMove; }
     if ( IsOccupied( move.to ) ) { return MoveError::IsOccupied; }
     if ( IsOutOfBounds( move.to ) ) { return MoveError::IsOutOfBounds; }
-    if ( !move.from.IsDiagonal( move.to ) ) { return MoveError::IsNotDiagonal; }
+    if ( !IsPlayable( move.to ) ) { return MoveError::IsNotDiagonal; } // Light squares are never diagonal to dark ones
+
+    // Look up whether the move is a single step or a jump
+    int from = Geometry::PosToSquare( move.from );
+    int to = Geometry::PosToSquare( move.to );
+    int moveDirection = -1;
+    bool isJump = false;
+    for ( int i = 0; i < NumberOfDirections; i++ ) {
+        Direction direction = static_cast<Direction>( i );
+        if ( Tables::GetNeighbourSquare( from, direction ) == to ) { moveDirection = i; }
+        if ( Tables::GetJumpSquare( from, direction ) == to ) { moveDirection = i; isJump = true; }
+    }
+    if ( moveDirection < 0 && !move.from.IsDiagonal( move.to ) ) { return MoveError::IsNotDiagonal; }
 
     // Check we're moving the right color piece
-    Piece piece = GetPiece( move.from );
-	PieceType pieceType = piece.pieceType;
-    if ( pieceType == PieceType::White && GetCurrentSide() != SideType::White ) { return MoveError::WrongSide; }
-    if ( pieceType == PieceType::Black && GetCurrentSide() != SideType::Black ) { return MoveError::WrongSide; }
+    Bitboard fromMask = Geometry::GetSquareMask( from );
+    if ( ( GetCurrentPieces() & fromMask ) == 0 ) { return MoveError::WrongSide; }
 
     // Check for backwards move
-    int forwardDist = move.to.row - move.from.row;
-    if ( !piece.isKing && forwardDist > 0 && pieceType == PieceType::Black ) { return MoveError::IsBackwards; }
-    if ( !piece.isKing && forwardDist < 0 && pieceType == PieceType::White ) { return MoveError::IsBackwards; }
+    bool isMovingUp = move.to.row > move.from.row;
+    bool isKing = ( m_kings & fromMask ) != 0;
+    bool isBackwardCapture = Geometry::HasBackwardManCaptures && isJump;
+    if ( !isKing && isMovingUp != ( GetCurrentSide() == SideType::White ) && !isBackwardCapture ) { return MoveError::IsBackwards; }
 
-    if ( move.IsAdjacentMove() ) {
-        // We're moving to an adjacent diagonal sqaure
-        return MoveError::None;
-    }
-    else if ( move.IsJumpMove() ) {
-        // We're jumping, check for an appropriate piece to jump
-		Pos jumpPos = move.GetJumpPos();
-        return IsOccupied( jumpPos, Piece::GetOpponentPieceType( pieceType ) ) ? MoveError::None : MoveError::NoJumpPiece;
+    // A flying king can slide any distance, or capture the first piece along the diagonal and land anywhere behind it
+    if ( Geometry::HasFlyingKings && isKing ) {
+        PackedMove packedMove = PackedMove::FromMove<Geometry>( move );
+        Bitboard toMask = Geometry::GetSquareMask( to );
+        if ( ( Rays::GetSlides( fromMask, GetEmptySquares(), packedMove.GetDirection() ) & toMask ) != 0 ) { return MoveError::None; }
+        Bitboard landings = Rays::GetCaptureLandings( fromMask, GetEmptySquares(), GetOpponentPieces(), packedMove.GetDirection() );
+        return ( landings & toMask ) != 0 ? MoveError::None : MoveError::NoJumpPiece;
     }
 
     // We're moving some other distance, not allowed
-    return MoveError::TooFar;
+    if ( moveDirection < 0 ) { return MoveError::TooFar; }
+
+    // We're moving to an adjacent diagonal sqaure
+    if ( !isJump ) { return MoveError::None; }
+
+    // We're jumping, check for an appropriate piece to jump
+    Bitboard jumped = Tables::GetNeighbourMask( from, static_cast<Direction>( moveDirection ) );
+    return ( GetOpponentPieces() & jumped ) != 0 ? MoveError::None : MoveError::NoJumpPiece;
 }
 
-void CheckersBoard::DoMove( const Move &move )
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::DoMove( const Move &move )
 {
     if ( !CanMove( move ) ) { throw std::out_of_range( "Move is not allowed" ); }
+    DoMoveUnchecked( move );
+}
 
-    Piece piece = GetPiece( move.from );
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::DoMoveUnchecked( const Move &move )
+{
+    DoMoveUnchecked( ToPackedMove( move ) );
+}
 
-	// Check for king making
-    if( IsOnLastRow(piece.pieceType, move.to) ) {
-        piece.isKing = true;
-    }
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::DoMoveUnchecked( const PackedMove &move )
+{
+    Bitboard from = Geometry::GetSquareMask( move.GetFrom() );
+    Bitboard to = Geometry::GetSquareMask( move.GetTo() );
+    bool isKing = ( m_kings & from ) != 0;
+    bool isWhite = m_currentSide == SideType::White;
 
 	// Do the actual move
-    RemovePiece( move.from );
-    SetPiece( move.to, piece );
+    Bitboard &pieces = GetCurrentPiecesRef();
+    pieces = ( pieces & ~from ) | to;
+    m_kings &= ~from;
+
+	// Check for king making. A man that can capture through the king row is only crowned if its capture ends there.
+    bool isCrowned = !isKing && ( to & GetKingRow() ) != 0;
+    bool isCrownDeferred = isCrowned && Geometry::HasCaptureThroughKingRow && move.IsJump();
+    if ( isKing || ( isCrowned && !isCrownDeferred ) ) {
+        m_kings |= to;
+    }
+    m_hash ^= Zobrist::GetPieceKey( isWhite, isKing, move.GetFrom() ) ^ Zobrist::GetPieceKey( isWhite, ( m_kings & to ) != 0, move.GetTo() );
 
 	// Check for jump
-	if (move.IsJumpMove())
+    bool isJump = move.IsJump();
+    InvalidateJumpers();
+	if (isJump)
 	{
-		// Remove the captured piece
-		auto jumpPos = move.GetJumpPos();
-		RemovePiece(jumpPos);
+		// Remove the captured piece. A flying king could reach past its square later in the sequence, so on flying
+		// boards it stays until the move is over.
+		int jumpedSquare = GetJumpedSquare( move );
+		Bitboard jumped = Geometry::GetSquareMask( jumpedSquare );
+		if ( Geometry::HasFlyingKings ) {
+			m_capturedPieces |= jumped;
+			m_capturingPiece = to;
+		}
+		else {
+			m_hash ^= Zobrist::GetPieceKey( !isWhite, ( m_kings & jumped ) != 0, jumpedSquare );
+			GetOpponentPiecesRef() &= ~jumped;
+			m_kings &= ~jumped;
+		}
 	}
 
-    // Only swap sides if we can't jump again from our new Pos
-    std::vector<Move> jumpMoves;
-    GetJumpMoves( move.to, jumpMoves );
-	if ( jumpMoves.empty() )
+    // Only swap sides if we can't jump again from our new Pos. Being crowned ends the move.
+	if ( !isJump || ( isCrowned && !isCrownDeferred ) || ( GetJumpers() & to ) == 0 )
     {
+		if ( isCrownDeferred ) {
+			m_kings |= to;
+			m_hash ^= Zobrist::GetPieceKey( isWhite, false, move.GetTo() ) ^ Zobrist::GetPieceKey( isWhite, true, move.GetTo() );
+		}
+		if ( m_capturedPieces != 0 ) {
+			m_hash ^= Zobrist::GetPiecesKey( !isWhite, false, m_capturedPieces & ~m_kings ) ^ Zobrist::GetPiecesKey( !isWhite, true, m_capturedPieces & m_kings );
+			GetOpponentPiecesRef() &= ~m_capturedPieces;
+			m_kings &= ~m_capturedPieces;
+			m_capturedPieces = 0;
+		}
+
 		m_currentSide = GetCurrentOpponentSide();
+		m_hash ^= Zobrist::GetSideKey();
+		InvalidateJumpers();
+    }
+
+    CheckHash();
+}
+
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::DoMove( const MovePath &movePath )
+{
+    if ( !IsLegalMove( movePath ) ) { throw std::out_of_range( "Move is not allowed" ); }
+    DoMoveUnchecked( movePath );
+}
+
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::DoMove( const MovePath &movePath, UndoRecord &undoRecord )
+{
+    assert( IsLegalMove( movePath ) );
+
+    undoRecord.from = static_cast<uint8_t>( movePath.GetFrom() );
+    undoRecord.to = static_cast<uint8_t>( movePath.GetTo() );
+    undoRecord.wasKing = ( m_kings & Geometry::GetSquareMask( movePath.GetFrom() ) ) != 0;
+    undoRecord.side = m_currentSide;
+    undoRecord.captured = movePath.captured;
+    undoRecord.capturedKings = movePath.captured & m_kings;
+    undoRecord.hash = m_hash;
+
+    DoMoveUnchecked( movePath );
+}
+
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::UndoMove( const UndoRecord &undoRecord )
+{
+    m_currentSide = undoRecord.side;
+
+    Bitboard from = Geometry::GetSquareMask( undoRecord.from );
+    Bitboard to = Geometry::GetSquareMask( undoRecord.to );
+
+    // Clear before setting, the move may have ended where it started.
+    Bitboard &pieces = GetCurrentPiecesRef();
+    pieces = ( pieces & ~to ) | from;
+    m_kings &= ~to;
+    if ( undoRecord.wasKing ) { m_kings |= from; }
+
+    GetOpponentPiecesRef() |= undoRecord.captured;
+    m_kings |= undoRecord.capturedKings;
+    m_hash = undoRecord.hash;
+    InvalidateJumpers();
+
+    CheckHash();
+}
+
+template<typename Geometry>
+bool BasicCheckersBoard<Geometry>::IsLegalMove( const MovePath &movePath ) const
+{
+    // Reject moves that ignore a forced capture, or capture with the wrong piece, without generating anything
+    Bitboard jumpers = GetJumpers();
+    if ( movePath.IsCapture() != ( jumpers != 0 ) ) { return false; }
+    if ( movePath.IsCapture() && ( jumpers & Geometry::GetSquareMask( movePath.GetFrom() ) ) == 0 ) { return false; }
+
+    MovePathList movePaths;
+    GetMovePaths( movePaths );
+
+    // The maximum capture rule keeps one of the sequences that take the same pieces in a different order.
+    if ( Geometry::HasMaximumCapture ) {
+        return std::find_if( movePaths.begin(), movePaths.end(), [&movePath]( const MovePath &legalPath ) { return legalPath.IsSameMove( movePath ); } ) != movePaths.end();
+    }
+    return std::find( movePaths.begin(), movePaths.end(), movePath ) != movePaths.end();
+}
+
+template<typename Geometry>
+void BasicCheckersBoard<Geometry>::DoMoveUnchecked( const MovePath &movePath )
+{
+    Bitboard from = Geometry::GetSquareMask( movePath.GetFrom() );
+    Bitboard to = Geometry::GetSquareMask( movePath.GetTo() );
+    bool isKing = ( m_kings & from ) != 0;
+    bool isKingAfter = isKing || ( to & GetKingRow() ) != 0;
+    bool isWhite = m_currentSide == SideType::White;
+
+    m_hash ^= Zobrist::GetPieceKey( isWhite, isKing, movePath.GetFrom() ) ^ Zobrist::GetPieceKey( isWhite, isKingAfter, movePath.GetTo() );
+    m_hash ^= Zobrist::GetPiecesKey( !isWhite, false, movePath.captured & ~m_kings );
+    m_hash ^= Zobrist::GetPiecesKey( !isWhite, true, movePath.captured & m_kings );
+    m_hash ^= Zobrist::GetSideKey();
+
+    // A capture sequence can end where it started, so clear before setting.
+    Bitboard &pieces = GetCurrentPiecesRef();
+    pieces = ( pieces & ~from ) | to;
+    GetOpponentPiecesRef() &= ~movePath.captured;
+    m_kings &= ~( movePath.captured | from );
+    if ( isKingAfter ) {
+        m_kings |= to;
     }
+
+    m_currentSide = GetCurrentOpponentSide();
+    InvalidateJumpers();
+
+    CheckHash();
 }
+
+template class checkers::BasicCheckersBoard<Geometry8x8>;
+template class checkers::BasicCheckersBoard<Geometry10x10>;
+template class checkers::BasicCheckersBoard<Geometry8x8FlyingKings>;
+template class checkers::BasicCheckersBoard<Geometry10x10FlyingKings>;
+template class checkers::BasicCheckersBoard<Geometry10x10MaximumCapture>;
@@ -2,10 +2,16 @@
 
 #include <assert.h>
 #include <tuple>
-#include <vector>
 
+#include "Bitboard.h"
+#include "BoardGeometry.h"
 #include "Move.h"
+#include "MoveList.h"
+#include "MovePath.h"
 #include "Piece.h"
+#include "RayAttacks.h"
+#include "SquareTables.h"
+#include "Zobrist.h"
 
 namespace checkers
 {
@@ -14,28 +20,50 @@ namespace checkers
  * Represents a logical CheckersBoard, including all the sqaures and the pieces on those squares.
  * Defines operations for moving, get and setting pieces on square.
  * Checks move errors and performs moves.
+ *
+ * Pieces are stored as bitboards over the playable squares, so a board is a few machine words and cheap to copy.
+ * Only squares where (row + column) is odd are playable, the other squares can never hold a piece.
+ *
+ * The board size and rule options are a compile time Geometry, CheckersBoard is the standard 8x8 board.
+ * The members are defined in CheckersBoard.cpp and instantiated there for each supported geometry.
  */
-class CheckersBoard
+template<typename Geometry>
+class BasicCheckersBoard
 {
 public:
+    typedef typename Geometry::Bitboard Bitboard;
+    typedef BasicMovePath<Geometry> MovePath;
+    typedef typename MoveLists<Geometry>::MoveList MoveList;
+    typedef typename MoveLists<Geometry>::MovePathList MovePathList;
+
 	enum class WinType { White, Black, Draw };
 	enum class SideType { White, Black };
     enum class MoveError {	None, IsOutOfBounds, IsOccupied, IsNotDiagonal, IsNotAdjacent, NoJumpPiece, // 5
-							TooFar, NoPieceToMove, WrongSide, IsBackwards, MustJump
+							TooFar, NoPieceToMove, WrongSide, IsBackwards, MustJump, // 10
+							NotMaximumCapture, MustContinueCapture
                          };
 
-    const static int NumberOfSquares = 64;
-    const static int NumberOfColumns = 8;
-    const static int NumberOfRows = 8;
+    /// Everything needed to take back a move made with DoMove( movePath, undoRecord ).
+    struct UndoRecord
+    {
+        uint8_t from;
+        uint8_t to;
+        bool wasKing;
+        SideType side;
+        Bitboard captured;
+        Bitboard capturedKings;
+        uint64_t hash;
+    };
+
+    const static int NumberOfSquares = Geometry::NumberOfSquares;
+    const static int NumberOfColumns = Geometry::NumberOfColumns;
+    const static int NumberOfRows = Geometry::NumberOfRows;
 
     /// Creates a new board with the default piece layout.
-    CheckersBoard() : CheckersBoard( DefaultPieceLayout, SideType::White ) {}
+    BasicCheckersBoard();
 
     /// Create a board with a custom layout and starting side.
-    CheckersBoard( const Piece::PieceType pieceTypes[NumberOfSquares], SideType currentSide );
-
-	// Copy constructor
-	CheckersBoard(const CheckersBoard& board);
+    BasicCheckersBoard( const Piece::PieceType pieceTypes[NumberOfSquares], SideType currentSide );
 
     SideType GetCurrentSide() const { return m_currentSide;  }
 
@@ -56,18 +84,25 @@ public:
 	void RemovePiece( const Pos &pos );
 
 	/// Get all the legal moves that the current side can make.
-	void GetMoves(std::vector<Move> &moves) const;
+	void GetMoves(MoveList &moves) const;
 
 	/// Get all the legal moves that the current side can make from the given Pos.
-	void GetMoves(const Pos &pos, std::vector<Move> &moves) const;
+	void GetMoves(const Pos &pos, MoveList &moves) const;
 
     /// Get all the jump moves that the current size can make.
-    void GetJumpMoves( std::vector<Move> &jumpMoves ) const;
+    void GetJumpMoves( MoveList &jumpMoves ) const;
 
     /// Get all the jump moves that the current side can make from the given Pos.
-    void GetJumpMoves( const Pos &pos, std::vector<Move> &jumpMoves ) const;
+    void GetJumpMoves( const Pos &pos, MoveList &jumpMoves ) const;
+
+    /**
+     * Get every complete move the current side can make. Each capture sequence is a single MovePath.
+     * With the maximum capture rule only the sequences taking the most pieces are returned, and sequences that only
+     * differ in the order they took the pieces are returned once.
+     */
+    void GetMovePaths( MovePathList &movePaths ) const;
 
-    /// Returns whether the position is occupied. An out of bounds pos is considered occupied.
+    /// Returns whether the position is occupied. An out of bounds pos is considered occupied, a non-playable square is not.
     bool IsOccupied( const Pos &pos ) const;
 
     // Returns whether a square is occupied by a particular PieceType.
@@ -76,31 +111,209 @@ public:
     /// Returns whether a position is out of bounds.
     bool IsOutOfBounds( const Pos &pos ) const;
 
+    /// Returns whether a position is on the board and on a square that can hold a piece.
+    bool IsPlayable( const Pos &pos ) const;
+
     /// Returns whether a move can be made.
     bool CanMove( const Move &move ) const;
 
     /// Verifies a move and returns the error, can be MoveError::None.
     MoveError GetMoveError( const Move &move ) const;
 
-    /// Performs the move
+    /// Performs the move. Throws std::out_of_range if the move isn't allowed.
     void DoMove( const Move &move );
 
+    /// Performs a whole move, including every jump of a capture sequence, and passes the turn.
+    /// Throws std::out_of_range if the move isn't allowed.
+    void DoMove( const MovePath &movePath );
+
+    /// Performs a move that came from GetMoves or GetJumpMoves for this position. The move isn't checked.
+    void DoMoveUnchecked( const Move &move );
+
+    /**
+     * Performs a move that came from GetMoves or GetJumpMoves for this position. The move isn't checked.
+     * On flying boards the pieces a capture sequence takes stay on the board until its last jump, as they do in
+     * GetMovePaths, and only the capturing piece may carry on. Playing a MovePath a hop at a time plays the same move.
+     */
+    void DoMoveUnchecked( const PackedMove &move );
+
+    /// Performs a whole move that came from GetMovePaths for this position. The move isn't checked.
+    void DoMoveUnchecked( const MovePath &movePath );
+
+    /**
+     * Performs a whole move in place and fills in undoRecord so UndoMove can restore the board exactly.
+     * The move must come from GetMovePaths for this position, it isn't checked.
+     */
+    void DoMove( const MovePath &movePath, UndoRecord &undoRecord );
+
+    /// Takes back the move that filled in undoRecord. Moves must be undone in the reverse order they were made.
+    void UndoMove( const UndoRecord &undoRecord );
+
+	/**
+	 * Returns the Zobrist hash of the position, including the side to move.
+	 * It's kept up to date as pieces are set and moves are made or undone.
+	 */
+	uint64_t GetHash() const { return m_hash; }
+
+	/// Computes the Zobrist hash from scratch.
+	uint64_t ComputeHash() const;
+
+	/// The squares of a side's pieces, kings included.
+	Bitboard GetPieces(SideType side) const { return side == SideType::White ? m_whitePieces : m_blackPieces; }
+
+	/// The squares of the kings of either side.
+	Bitboard GetKings() const { return m_kings; }
+
+	/// Returns the number of pieces, kings included, that a side has on the board.
+	int GetPieceCount(SideType side) const { return PopCount(side == SideType::White ? m_whitePieces : m_blackPieces); }
+
+	/// Returns the number of kings that a side has on the board.
+	int GetKingCount(SideType side) const { return PopCount((side == SideType::White ? m_whitePieces : m_blackPieces) & m_kings); }
+
+	/// Returns whether the current side has any legal move, without generating them.
+	bool HasMoves() const;
+
+	/// Returns whether the game is over: a side has no pieces left or the current side can't move.
 	bool IsFinished() const;
 
 	WinType GetWinner() const;
 
+	/// Boards are equal when they have the same pieces and the same side to move.
+	bool operator== (const BasicCheckersBoard& rhs) const
+	{
+		return m_currentSide == rhs.m_currentSide && m_whitePieces == rhs.m_whitePieces &&
+			m_blackPieces == rhs.m_blackPieces && m_kings == rhs.m_kings && m_capturedPieces == rhs.m_capturedPieces;
+	}
+
+	bool operator!= (const BasicCheckersBoard& rhs) const
+	{
+		return !(*this == rhs);
+	}
+
 private:
-    /// Convert a Pos into an index into the board array.
-    static int PosToIndex( const Pos &pos ) { return ( pos.row * NumberOfColumns ) + pos.column; }
+	typedef SquareTables<Geometry> Tables;
+	typedef RayAttacks<Geometry> Rays;
 
 	SideType GetCurrentOpponentSide() const
 	{
 		return GetCurrentSide() == SideType::White ? SideType::Black : SideType::White;
 	}
 
-	/// Get all the legal moves from startPos. Moves are made usingthe moveDeltas.
-	// Legal moves are added to the moves vector.
-	void GetMoves(const Pos &startPos, const Pos moveDeltas[4], std::vector<Move> &moves) const;
+	/// The pieces of the side to move.
+	Bitboard GetCurrentPieces() const { return m_currentSide == SideType::White ? m_whitePieces : m_blackPieces; }
+
+	/// The pieces of the side that isn't moving, less the ones already taken by a capture sequence that isn't over.
+	Bitboard GetOpponentPieces() const { return ( m_currentSide == SideType::White ? m_blackPieces : m_whitePieces ) & ~m_capturedPieces; }
+
+	/// The playable squares without a piece on them.
+	Bitboard GetEmptySquares() const { return Geometry::GetAllSquares() & ~( m_whitePieces | m_blackPieces ); }
+
+	/// Returns whether the direction is forwards for the men of the current side.
+	bool IsForward(Direction direction) const;
+
+	/// Returns which of the given pieces of the current side may step in the direction. Only kings can move backwards.
+	Bitboard GetMovers(Bitboard pieces, Direction direction) const;
+
+	/// Returns which of the given pieces of the current side may capture in the direction. Men capture backwards too
+	/// when the geometry has backward man captures.
+	Bitboard GetCapturingPieces(Bitboard pieces, Direction direction) const
+	{
+		return Geometry::HasBackwardManCaptures ? pieces : GetMovers(pieces, direction);
+	}
+
+	/// Returns whether a piece of the current side may capture in the direction.
+	bool IsCaptureDirection(bool isKing, Direction direction) const
+	{
+		return isKing || Geometry::HasBackwardManCaptures || IsForward(direction);
+	}
+
+	/// The kings among the pieces when kings fly, they slide along rays instead of stepping. None otherwise.
+	Bitboard GetFlyingKings(Bitboard pieces) const { return Geometry::HasFlyingKings ? pieces & m_kings : 0; }
+
+	/// The square of the piece captured by a jump. A flying king captures the first piece along its ray.
+	int GetJumpedSquare(const PackedMove &move) const;
+
+	/// Packs a Pos based move. A flying king's move is a jump when it passes a piece, whatever its length.
+	PackedMove ToPackedMove(const Move &move) const;
+
+	/// The row where the men of the current side are crowned.
+	Bitboard GetKingRow() const { return Tables::GetPromotionRow( m_currentSide == SideType::White ); }
+
+	/**
+	 * Returns the squares of the current side's pieces that have a jump available.
+	 * Computed once per position and cached, the forced capture rule needs it for every move that's checked.
+	 */
+	Bitboard GetJumpers() const
+	{
+		if (!m_isJumpersValid) {
+			m_jumpers = ComputeJumpers();
+			m_isJumpersValid = true;
+		}
+		return m_jumpers;
+	}
+
+	/// Finds the squares of the current side's pieces that have a jump available, with whole board shifts.
+	Bitboard ComputeJumpers() const;
+
+	/// Forgets the cached jumpers, called whenever the pieces or the side to move change.
+	void InvalidateJumpers() { m_isJumpersValid = false; }
+
+	/// Add all simple (non-jump) moves of the given pieces of the current side, found with whole board shifts.
+	void AddSimpleMoves(Bitboard pieces, MoveList &moves) const;
+
+	/// Add all jump moves of the given pieces of the current side, found with whole board shifts.
+	void AddJumpMoves(Bitboard pieces, MoveList &moves) const;
+
+	/// Add the slides of a flying king to every empty square along its rays.
+	void AddKingSlides(int from, MoveList &moves) const;
+
+	/**
+	 * Extend the capture sequence in movePath, which has landed on square, by every possible next jump.
+	 * Complete sequences are added to movePaths. A man that is crowned ends the sequence, unless the geometry lets men
+	 * capture through the king row.
+	 */
+	void AddCaptureSequences(MovePath &movePath, bool isKing, Bitboard empty, MovePathList &movePaths) const;
+
+	/// The state of a search for the longest capture sequences, shared by every level of the search.
+	struct CaptureSearch
+	{
+		MovePath path;         // The sequence being searched, squares are added and removed in place.
+		Bitboard empty;        // The empty squares, including the square the capturing piece started on.
+		Bitboard capturable;   // The opponent pieces that could ever be captured, the ones off the edge.
+		bool isKing;
+		int best;              // The most pieces taken by a sequence found so far.
+		int firstPath;         // Where this search's sequences start in the move path list.
+	};
+
+	/// Add the capture sequences of the jumpers that take the most pieces, for the maximum capture rule.
+	void AddMaximumCaptures(Bitboard jumpers, MovePathList &movePaths) const;
+
+	/**
+	 * Depth first search of the capture sequences continuing search.path.
+	 * Branches that can't take as many pieces as the best sequence found so far, even by taking every capturable piece
+	 * that's left, are cut off.
+	 */
+	void SearchMaximumCaptures(CaptureSearch &search, MovePathList &movePaths) const;
+
+	/// Adds a complete sequence if it takes at least as many pieces as the best so far, dropping the shorter ones.
+	void AddMaximumCapture(CaptureSearch &search, MovePathList &movePaths) const;
+
+	/// With the maximum capture rule, removes the jumps that don't start one of the longest capture sequences.
+	void RemoveShorterCaptures(MoveList &moves) const;
+
+	/// Returns whether the move path is one of the legal moves in this position.
+	bool IsLegalMove(const MovePath &movePath) const;
+
+	/// With CHECKERS_DEBUG_HASH defined, checks the incremental hash against a full recomputation.
+	void CheckHash() const
+	{
+#ifdef CHECKERS_DEBUG_HASH
+		assert(m_hash == ComputeHash() && "Incremental hash is wrong");
+#endif
+	}
+
+	Bitboard& GetCurrentPiecesRef() { return m_currentSide == SideType::White ? m_whitePieces : m_blackPieces; }
+	Bitboard& GetOpponentPiecesRef() { return m_currentSide == SideType::White ? m_blackPieces : m_whitePieces; }
 
 	// Returns a pair of bools that represent whether a side has pieces on the board. In White, Black order.
 	std::tuple<bool, bool> GetSideHasPieces() const;
@@ -108,53 +321,117 @@ private:
     /// Checks for all move errors, but doesn't return an error if there is a jump available.
     MoveError GetMoveError_DontForceJumps( const Move &move ) const;
 
-    /// Returns true if the piece is on the far side of the board for its type.
-    bool IsOnLastRow( const Piece::PieceType &pieceType, const Pos &pos ) const;
-
     /// The current side whose turn it is to move.
     SideType m_currentSide;
 
-    /// The board array.
-    Piece m_pieces[NumberOfSquares];
+    /// The playable squares occupied by white pieces.
+    Bitboard m_whitePieces;
+
+    /// The playable squares occupied by black pieces.
+    Bitboard m_blackPieces;
 
-    // The default starting positions of all the pieces.
-    static const Piece::PieceType DefaultPieceLayout[NumberOfSquares];
+    /// The playable squares occupied by kings of either side.
+    Bitboard m_kings;
 
+    /// The Zobrist hash of the position, updated incrementally.
+    uint64_t m_hash;
+
+    /// On flying boards, the pieces taken so far by a capture sequence played a hop at a time.
+    /// They're removed when the sequence is over, until then they block rays but can't be taken again.
+    Bitboard m_capturedPieces;
+
+    /// The piece making that capture sequence, the only one that may carry on with it.
+    Bitboard m_capturingPiece;
+
+    /// The cached result of ComputeJumpers, when m_isJumpersValid is set.
+    /// Filled in by const methods, so a board shouldn't be shared between threads without copying it.
+    mutable Bitboard m_jumpers;
+    mutable bool m_isJumpersValid;
 };
 
-inline Piece CheckersBoard::GetPiece( const Pos &pos ) const
+template<typename Geometry> const int BasicCheckersBoard<Geometry>::NumberOfSquares;
+template<typename Geometry> const int BasicCheckersBoard<Geometry>::NumberOfColumns;
+template<typename Geometry> const int BasicCheckersBoard<Geometry>::NumberOfRows;
+
+/// The standard 8x8 board.
+typedef BasicCheckersBoard<Geometry8x8> CheckersBoard;
+
+/// The 10x10 board of international draughts, played with the same rules as the standard board.
+typedef BasicCheckersBoard<Geometry10x10> DraughtsBoard;
+
+/// The 10x10 board with flying kings.
+typedef BasicCheckersBoard<Geometry10x10FlyingKings> FlyingKingsDraughtsBoard;
+
+/// The 10x10 board with the international draughts rules.
+typedef BasicCheckersBoard<Geometry10x10MaximumCapture> MaximumCaptureDraughtsBoard;
+
+template<typename Geometry>
+inline Piece BasicCheckersBoard<Geometry>::GetPiece( const Pos &pos ) const
 {
-    if ( IsOutOfBounds( pos ) ) { return Piece(Piece::PieceType::None); }
-    return m_pieces[PosToIndex( pos )];
+    if ( !IsPlayable( pos ) ) { return Piece(Piece::PieceType::None, false); }
+    Bitboard mask = Geometry::GetSquareMask( Geometry::PosToSquare( pos ) );
+    bool isKing = ( m_kings & mask ) != 0;
+    if ( m_whitePieces & mask ) { return Piece( Piece::PieceType::White, isKing ); }
+    if ( m_blackPieces & mask ) { return Piece( Piece::PieceType::Black, isKing ); }
+    return Piece(Piece::PieceType::None, false);
 }
 
-inline void CheckersBoard::SetPiece( const Pos &pos, const Piece& piece )
+template<typename Geometry>
+inline void BasicCheckersBoard<Geometry>::SetPiece( const Pos &pos, const Piece& piece )
 {
     if ( IsOutOfBounds( pos ) ) { assert( false && "Piece out of bounds" ); return; }
-    m_pieces[PosToIndex( pos )] = piece;
+    if ( !IsPlayable( pos ) ) {
+        assert( piece.pieceType == Piece::PieceType::None && "Piece on a non-playable square" );
+        return;
+    }
+
+    int square = Geometry::PosToSquare( pos );
+    Bitboard mask = Geometry::GetSquareMask( square );
+    if ( ( m_whitePieces | m_blackPieces ) & mask ) {
+        m_hash ^= Zobrist::GetPieceKey( ( m_whitePieces & mask ) != 0, ( m_kings & mask ) != 0, square );
+    }
+    m_whitePieces &= ~mask;
+    m_blackPieces &= ~mask;
+    m_kings &= ~mask;
+    m_capturedPieces &= ~mask;
+    InvalidateJumpers();
+
+    if ( piece.pieceType != Piece::PieceType::None ) {
+        if ( piece.pieceType == Piece::PieceType::White ) { m_whitePieces |= mask; }
+        else { m_blackPieces |= mask; }
+        if ( piece.isKing ) { m_kings |= mask; }
+        m_hash ^= Zobrist::GetPieceKey( piece.pieceType == Piece::PieceType::White, piece.isKing, square );
+    }
+
+    CheckHash();
 }
 
-inline void CheckersBoard::SetPiece(const Pos &pos, Piece::PieceType pieceType)
+template<typename Geometry>
+inline void BasicCheckersBoard<Geometry>::SetPiece(const Pos &pos, Piece::PieceType pieceType)
 {
 	SetPiece(pos, Piece(pieceType));
 }
 
-inline void CheckersBoard::RemovePiece(const Pos &pos)
+template<typename Geometry>
+inline void BasicCheckersBoard<Geometry>::RemovePiece(const Pos &pos)
 {
-	m_pieces[PosToIndex(pos)] = Piece(Piece::PieceType::None,false);
+	SetPiece(pos, Piece(Piece::PieceType::None, false));
 }
 
-inline bool CheckersBoard::IsOccupied( const Pos &pos ) const
+template<typename Geometry>
+inline bool BasicCheckersBoard<Geometry>::IsOccupied( const Pos &pos ) const
 {
     return IsOccupied( pos, Piece::PieceType::Black ) || IsOccupied( pos, Piece::PieceType::White );
 }
 
-inline bool CheckersBoard::IsOccupied( const Pos &pos, Piece::PieceType pieceType ) const
+template<typename Geometry>
+inline bool BasicCheckersBoard<Geometry>::IsOccupied( const Pos &pos, Piece::PieceType pieceType ) const
 {
-    return IsOutOfBounds( pos ) || pieceType == m_pieces[PosToIndex( pos )].pieceType;
+    return IsOutOfBounds( pos ) || pieceType == GetPiece( pos ).pieceType;
 }
 
-inline bool CheckersBoard::IsOutOfBounds( const Pos &pos ) const
+template<typename Geometry>
+inline bool BasicCheckersBoard<Geometry>::IsOutOfBounds( const Pos &pos ) const
 {
     return  pos.row < 0 ||
             pos.row >= NumberOfRows ||
@@ -162,62 +439,44 @@ inline bool CheckersBoard::IsOutOfBounds( const Pos &pos ) const
             pos.column >= NumberOfColumns;
 }
 
-inline bool CheckersBoard::CanMove( const Move &move ) const
+template<typename Geometry>
+inline bool BasicCheckersBoard<Geometry>::IsPlayable( const Pos &pos ) const
 {
-    return GetMoveError( move ) == MoveError::None;
+    return !IsOutOfBounds( pos ) && ( ( pos.row + pos.column ) & 1 ) == 1;
 }
 
-inline bool CheckersBoard::IsOnLastRow( const Piece::PieceType &pieceType, const Pos &pos ) const
+template<typename Geometry>
+inline bool BasicCheckersBoard<Geometry>::CanMove( const Move &move ) const
 {
-    if ( pieceType == Piece::PieceType::White && pos.row == NumberOfRows - 1 ) {
-        return true;
-    }
-    else if ( pieceType == Piece::PieceType::Black && pos.row == 0 ) {
-        return true;
-    }
-
-    return false;
+    return GetMoveError( move ) == MoveError::None;
 }
 
-inline bool CheckersBoard::IsFinished() const
+template<typename Geometry>
+inline bool BasicCheckersBoard<Geometry>::IsFinished() const
 {
 	auto sideHasPieces = GetSideHasPieces();
-	return !std::get<0>(sideHasPieces) || !std::get<1>(sideHasPieces);
+	return !std::get<0>(sideHasPieces) || !std::get<1>(sideHasPieces) || !HasMoves();
 }
 
-inline CheckersBoard::WinType CheckersBoard::GetWinner() const
+template<typename Geometry>
+inline typename BasicCheckersBoard<Geometry>::WinType BasicCheckersBoard<Geometry>::GetWinner() const
 {
 	auto sideHasPieces = GetSideHasPieces();
 	if (!std::get<0>(sideHasPieces) && !std::get<1>(sideHasPieces)) { return WinType::Draw; } // Can't happen in normal game
 	if (std::get<0>(sideHasPieces) && !std::get<1>(sideHasPieces)) { return WinType::White; }
 	if (!std::get<0>(sideHasPieces) && std::get<1>(sideHasPieces)) { return WinType::Black; }
-	std::vector<Move> moves;
-	GetMoves(moves);
-	if (moves.empty()) return GetWinTypeFromSideType( GetCurrentOpponentSide() ); // Can't move means you lose
+	if (!HasMoves()) return GetWinTypeFromSideType( GetCurrentOpponentSide() ); // Can't move means you lose
 
-	/*
-	TODO: Draw
-	Their next move they would create the same position for the third time during the game.
-	Neither player has advanced an uncrowned man towards the king-row during their own previous 40 moves.
-	No pieces have been removed from the board during their own previous 40 moves.
-	*/
+	// Draws depend on the moves played so far, see CheckersGame.
 
 	assert(false && "No winner");
 	return WinType::Draw;
 }
 
-inline std::tuple<bool, bool> CheckersBoard::GetSideHasPieces() const
+template<typename Geometry>
+inline std::tuple<bool, bool> BasicCheckersBoard<Geometry>::GetSideHasPieces() const
 {
-	bool hasWhite = false;
-	bool hasBlack = false;
-
-	for (auto piece : m_pieces)
-	{
-		if (piece.pieceType == Piece::PieceType::Black) { hasBlack = true; }
-		if (piece.pieceType == Piece::PieceType::White) { hasWhite = true; }
-	}
-
-	return std::tuple<bool,bool>{ hasWhite, hasBlack };
+	return std::tuple<bool,bool>{ m_whitePieces != 0, m_blackPieces != 0 };
 }
 
 
@@ -17,19 +17,21 @@ namespace checkers {
 class CheckersBoardNode
 {
 public:
-	CheckersBoardNode(CheckersBoardNode* parent, const CheckersBoard& board, Move move, CheckersBoard::WinType winType) :
+	CheckersBoardNode(CheckersBoardNode* parent, const CheckersBoard& board, MovePath move, CheckersBoard::WinType winType) :
 		m_parent(parent),
 		m_board(board),
 		m_move(move),
 		m_winType(winType),
 		m_wins(0)
 	{
-		m_board.GetMoves(m_moves);
+		MovePathList moves;
+		m_board.GetMovePaths(moves);
+		m_moves.assign(moves.begin(), moves.end());
 	}
 
 	const CheckersBoardNode* GetParent() const { return m_parent;  }
 
-	Move GetMove() const { return m_move;  }
+	MovePath GetMove() const { return m_move;  }
 
 	bool IsWin() const
 	{
@@ -54,17 +56,17 @@ public:
 		return m_children;
 	}
 
-	Move GetBestMove() const
+	MovePath GetBestMove() const
 	{
 		auto bestChildNode = std::max_element(m_children.begin(), m_children.end(),
 			[](const CheckersBoardNode& n1, const CheckersBoardNode& n2){ return n1.GetWins() < n2.GetWins(); });
 		if (bestChildNode != m_children.end()) {
 			return bestChildNode->GetMove();
 		}
-		return Move();
+		return MovePath();
 	}
 
-	Move GetRandomMove() const
+	MovePath GetRandomMove() const
 	{
 		assert(!m_moves.empty());
 		std::random_device rng;
@@ -79,7 +81,7 @@ private:
 		for (unsigned int i = 0; i < m_moves.size(); i++)
 		{
 			CheckersBoard childBoard(m_board);
-			childBoard.DoMove(m_moves[i]);
+			childBoard.DoMoveUnchecked(m_moves[i]);
 			m_children.emplace_back( this, childBoard, m_moves[i], m_winType );
 		}
 	}
@@ -88,8 +90,8 @@ private:
 	std::vector<CheckersBoardNode> m_children;
 
 	CheckersBoard m_board;
-	Move m_move;
-	std::vector<Move> m_moves;
+	MovePath m_move;
+	std::vector<MovePath> m_moves;
 
 	CheckersBoard::WinType m_winType;
 	int m_wins;
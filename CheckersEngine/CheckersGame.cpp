@@ -0,0 +1,63 @@
+#include "CheckersGame.h"
+
+#include <assert.h>
+
+using namespace checkers;
+
+const int CheckersGame::DrawPlies;
+const int CheckersGame::DrawRepetitions;
+
+CheckersGame::CheckersGame( const CheckersBoard &board ) :
+    m_board( board ),
+    m_reversiblePlies( 0 )
+{
+    // Enough for most games, so a search doesn't allocate as it makes moves
+    m_history.reserve( 256 );
+}
+
+void CheckersGame::DoMove( const MovePath &movePath )
+{
+    HistoryEntry entry;
+    entry.reversiblePlies = m_reversiblePlies;
+    m_board.DoMove( movePath, entry.undoRecord );
+    m_history.push_back( entry );
+
+    bool isIrreversible = movePath.IsCapture() || !entry.undoRecord.wasKing;
+    m_reversiblePlies = isIrreversible ? 0 : m_reversiblePlies + 1;
+}
+
+void CheckersGame::UndoMove()
+{
+    assert( !m_history.empty() );
+    const HistoryEntry &entry = m_history.back();
+    m_board.UndoMove( entry.undoRecord );
+    m_reversiblePlies = entry.reversiblePlies;
+    m_history.pop_back();
+}
+
+int CheckersGame::GetRepetitionCount() const
+{
+    // Undo records hold the hash from before their move. Only positions with the same side to move can match.
+    uint64_t hash = m_board.GetHash();
+    int count = 1;
+    int oldestPly = GetPly() - m_reversiblePlies;
+    for ( int ply = GetPly() - 2; ply >= oldestPly; ply -= 2 ) {
+        if ( m_history[ply].undoRecord.hash == hash ) {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool CheckersGame::IsDraw() const
+{
+    return m_reversiblePlies >= DrawPlies || GetRepetitionCount() >= DrawRepetitions;
+}
+
+CheckersBoard::WinType CheckersGame::GetWinner() const
+{
+    // A side that has lost can't also be in a drawn position, check the board first
+    if ( m_board.IsFinished() ) { return m_board.GetWinner(); }
+    assert( IsDraw() && "No winner" );
+    return CheckersBoard::WinType::Draw;
+}
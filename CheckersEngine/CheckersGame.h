@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CheckersBoard.h"
+#include "MovePath.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace checkers {
+
+/**
+ * A game in progress: a CheckersBoard plus the history needed for the draw rules.
+ * Keeps the undo record, which includes the position hash, for every move made and how many plies ago the last
+ * irreversible move was. A capture or a man moving can't be undone in play, so positions before it can't repeat.
+ *
+ * Draws:
+ * The same position, with the same side to move, has occurred three times.
+ * Neither player has advanced an uncrowned man or removed a piece during their own previous 40 moves.
+ */
+class CheckersGame
+{
+public:
+    /// 40 moves each without a man moving or a capture.
+    static const int DrawPlies = 80;
+
+    /// The number of times a position has to occur for a draw.
+    static const int DrawRepetitions = 3;
+
+    /// Starts a game from the default layout.
+    CheckersGame() : CheckersGame( CheckersBoard() ) {}
+
+    /// Starts a game from a board. Nothing before it counts towards a draw.
+    explicit CheckersGame( const CheckersBoard &board );
+
+    const CheckersBoard& GetBoard() const { return m_board; }
+
+    /// The number of moves made, that can be undone.
+    int GetPly() const { return static_cast<int>( m_history.size() ); }
+
+    /// Plies since the last capture or man move, or since the game started.
+    int GetReversiblePlies() const { return m_reversiblePlies; }
+
+    /// Performs a move that came from GetMovePaths for the current board, and records it.
+    void DoMove( const MovePath &movePath );
+
+    /// Takes back the last move.
+    void UndoMove();
+
+    /**
+     * Returns how many times the current position has occurred, including now.
+     * Only scans back as far as the last irreversible move, so is O(GetReversiblePlies()).
+     */
+    int GetRepetitionCount() const;
+
+    /// Returns whether the current position has occurred before. A search can treat this as a draw.
+    bool IsRepetition() const { return GetRepetitionCount() > 1; }
+
+    /// Returns whether the game is drawn by repetition or by the 40 move rule.
+    bool IsDraw() const;
+
+    /// Returns whether the game is over, by a win or a draw.
+    bool IsFinished() const { return IsDraw() || m_board.IsFinished(); }
+
+    /// Returns the winner of a finished game, WinType::Draw for a draw.
+    CheckersBoard::WinType GetWinner() const;
+
+private:
+    struct HistoryEntry
+    {
+        CheckersBoard::UndoRecord undoRecord;
+        int reversiblePlies;
+    };
+
+    CheckersBoard m_board;
+    std::vector<HistoryEntry> m_history;
+    int m_reversiblePlies;
+};
+
+}
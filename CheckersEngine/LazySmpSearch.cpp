@@ -0,0 +1,48 @@
+#include "LazySmpSearch.h"
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace checkers;
+
+AlphaBetaSearch::Result LazySmpSearch::Search( const CheckersBoard &board, int maxDepth )
+{
+    AlphaBetaSearch::Limits limits;
+    limits.maxDepth = maxDepth;
+    return Search( board, limits );
+}
+
+AlphaBetaSearch::Result LazySmpSearch::Search( const CheckersBoard &board, const AlphaBetaSearch::Limits &limits )
+{
+    TranspositionTable *transpositionTable = m_isDeterministic && limits.maxNodes > 0 ? nullptr : m_transpositionTable;
+    int helperCount = transpositionTable != nullptr ? std::max( m_threadCount, 1 ) - 1 : 0;
+
+    // Every thread searches its own copy, boards cache their jumpers so even const use writes to them.
+    CheckersBoard mainBoard = board;
+
+    // The helpers stop when the group is cancelled, and ones the pool hasn't got to yet are skipped.
+    TaskGroup helperGroup;
+    std::vector<uint64_t> helperNodes( helperCount, 0 );
+    for ( int i = 0; i < helperCount; i++ ) {
+        helperGroup.Run( [&, i]() {
+            CheckersBoard helperBoard = board;
+            AlphaBetaSearch search( transpositionTable );
+            search.SetStopFlag( helperGroup.GetCancelFlag() );
+            helperNodes[i] = search.Search( helperBoard, limits.maxDepth, 1 + i % 2 ).nodes;
+        } );
+    }
+
+    AlphaBetaSearch search( transpositionTable );
+    search.SetTableCutoffs( !m_isDeterministic );
+    AlphaBetaSearch::Result result = search.Search( mainBoard, limits );
+
+    helperGroup.Cancel();
+    helperGroup.Wait();
+
+    for ( uint64_t nodes : helperNodes ) {
+        result.nodes += nodes;
+    }
+    return result;
+}
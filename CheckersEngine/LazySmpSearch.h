@@ -0,0 +1,51 @@
+#pragma once
+
+#include "AlphaBetaSearch.h"
+#include "CheckersBoard.h"
+#include "TranspositionTable.h"
+
+namespace checkers {
+
+/**
+ * Alpha-beta search on several threads that share a transposition table, the Lazy SMP scheme.
+ * Every thread runs the same iterative deepening search on its own copy of the board. They don't divide the tree
+ * between them, they speed each other up through the table: a position one thread has searched is a cutoff or a
+ * good first move for the others. Half the helper threads start a ply deeper so they don't all search the same
+ * iteration in step. The main thread's result is the answer, the helpers are stopped when it finishes.
+ * The main search runs on the calling thread and the helpers are tasks on the engine's ThreadPool, so how many
+ * run at once is also limited by the pool's workers.
+ *
+ * Without a table the helpers couldn't help, so the search runs on one thread.
+ */
+class LazySmpSearch
+{
+public:
+    /// The table outlives the search and is shared between searches. threadCount includes the main thread.
+    LazySmpSearch( TranspositionTable *transpositionTable, int threadCount ) :
+        m_transpositionTable( transpositionTable ),
+        m_threadCount( threadCount ),
+        m_isDeterministic( false )
+    {}
+
+    /**
+     * When deterministic, the main thread only uses the table to order moves, so for a given depth the best move
+     * and score are the same whatever the thread count and timing. The helpers still fill the table, but with no
+     * cutoffs from it the main thread searches more nodes. With a node limit, where the table's move ordering would
+     * change how far the budget goes, the main thread doesn't use the table at all and there are no helpers.
+     * A time limit is never deterministic.
+     */
+    void SetDeterministic( bool isDeterministic ) { m_isDeterministic = isDeterministic; }
+
+    /// Searches to maxDepth. The result's node count is the total over all the threads.
+    AlphaBetaSearch::Result Search( const CheckersBoard &board, int maxDepth );
+
+    /// Searches within the limits, which apply to the main thread. The helpers stop when it does.
+    AlphaBetaSearch::Result Search( const CheckersBoard &board, const AlphaBetaSearch::Limits &limits );
+
+private:
+    TranspositionTable *m_transpositionTable;
+    int m_threadCount;
+    bool m_isDeterministic;
+};
+
+}
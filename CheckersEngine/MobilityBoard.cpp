@@ -0,0 +1,113 @@
+#include "MobilityBoard.h"
+
+using namespace checkers;
+
+template<typename Geometry>
+BasicMobilityBoard<Geometry>::BasicMobilityBoard( const Board &board ) :
+    m_board( board ),
+    m_lastUpdateCount( 0 )
+{
+    m_steppers[0] = m_steppers[1] = 0;
+    m_jumpers[0] = m_jumpers[1] = 0;
+    for ( int square = 0; square < Geometry::NumberOfPlayableSquares; square++ ) {
+        UpdateSquare( square );
+    }
+}
+
+template<typename Geometry>
+void BasicMobilityBoard<Geometry>::GetMoves( MoveList &moves ) const
+{
+    int side = m_board.GetCurrentSide() == SideType::White ? 0 : 1;
+
+    // If there are jump moves, we have to do them first.
+    bool isJumping = m_jumpers[side] != 0;
+    Bitboard pieces = isJumping ? m_jumpers[side] : m_steppers[side];
+    while ( pieces != 0 ) {
+        int from = PopLowestSquare( pieces );
+        Bitboard destinations = isJumping ? m_jumps[from] : m_steps[from];
+        for ( int i = 0; i < NumberOfDirections; i++ ) {
+            Direction direction = static_cast<Direction>( i );
+            Bitboard to = isJumping ? Tables::GetJumpMask( from, direction ) : Tables::GetNeighbourMask( from, direction );
+            if ( ( destinations & to ) != 0 ) {
+                int toSquare = isJumping ? Tables::GetJumpSquare( from, direction ) : Tables::GetNeighbourSquare( from, direction );
+                moves.push_back( PackedMove( from, toSquare, direction, isJumping ) );
+            }
+        }
+    }
+}
+
+template<typename Geometry>
+void BasicMobilityBoard<Geometry>::DoMoveUnchecked( const PackedMove &move )
+{
+    m_board.DoMoveUnchecked( move );
+    Update( Geometry::GetSquareMask( move.GetFrom() ) | Geometry::GetSquareMask( move.GetTo() ) |
+            ( move.IsJump() ? Geometry::GetSquareMask( move.template GetJumpedSquare<Geometry>() ) : 0 ) );
+}
+
+template<typename Geometry>
+void BasicMobilityBoard<Geometry>::DoMove( const MovePath &movePath, UndoRecord &undoRecord )
+{
+    m_board.DoMove( movePath, undoRecord );
+    Update( Geometry::GetSquareMask( undoRecord.from ) | Geometry::GetSquareMask( undoRecord.to ) | undoRecord.captured );
+}
+
+template<typename Geometry>
+void BasicMobilityBoard<Geometry>::UndoMove( const UndoRecord &undoRecord )
+{
+    m_board.UndoMove( undoRecord );
+    Update( Geometry::GetSquareMask( undoRecord.from ) | Geometry::GetSquareMask( undoRecord.to ) | undoRecord.captured );
+}
+
+template<typename Geometry>
+void BasicMobilityBoard<Geometry>::Update( Bitboard changed )
+{
+    Bitboard affected = 0;
+    while ( changed != 0 ) {
+        affected |= Tables::GetJumpDistanceMask( PopLowestSquare( changed ) );
+    }
+
+    m_lastUpdateCount = PopCount( affected );
+    while ( affected != 0 ) {
+        UpdateSquare( PopLowestSquare( affected ) );
+    }
+}
+
+template<typename Geometry>
+void BasicMobilityBoard<Geometry>::UpdateSquare( int square )
+{
+    Bitboard mask = Geometry::GetSquareMask( square );
+    Bitboard white = m_board.GetPieces( SideType::White );
+    Bitboard black = m_board.GetPieces( SideType::Black );
+    Bitboard empty = Geometry::GetAllSquares() & ~( white | black );
+    bool isWhite = ( white & mask ) != 0;
+    bool isKing = ( m_board.GetKings() & mask ) != 0;
+    Bitboard opponents = isWhite ? black : white;
+
+    Bitboard steps = 0;
+    Bitboard jumps = 0;
+    if ( ( ( white | black ) & mask ) != 0 ) {
+        for ( int i = 0; i < NumberOfDirections; i++ ) {
+            Direction direction = static_cast<Direction>( i );
+            bool isUp = direction == Direction::UpRight || direction == Direction::UpLeft;
+            if ( !isKing && isUp != isWhite ) { continue; } // Only kings can move backwards
+
+            steps |= Tables::GetNeighbourMask( square, direction ) & empty;
+            if ( ( Tables::GetNeighbourMask( square, direction ) & opponents ) != 0 ) {
+                jumps |= Tables::GetJumpMask( square, direction ) & empty;
+            }
+        }
+    }
+    m_steps[square] = steps;
+    m_jumps[square] = jumps;
+
+    for ( int side = 0; side < 2; side++ ) {
+        m_steppers[side] &= ~mask;
+        m_jumpers[side] &= ~mask;
+    }
+    int side = isWhite ? 0 : 1;
+    if ( steps != 0 ) { m_steppers[side] |= mask; }
+    if ( jumps != 0 ) { m_jumpers[side] |= mask; }
+}
+
+template class checkers::BasicMobilityBoard<Geometry8x8>;
+template class checkers::BasicMobilityBoard<Geometry10x10>;
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Bitboard.h"
+#include "BoardGeometry.h"
+#include "CheckersBoard.h"
+#include "SquareTables.h"
+
+namespace checkers {
+
+/**
+ * A CheckersBoard that keeps the step and jump destinations of every piece up to date as moves are made.
+ * A piece's moves only depend on the squares within jump distance of it, so after a move only the pieces near the
+ * squares that changed are looked at again. GetMoves then just reads the stored destinations.
+ *
+ * This is an optional wrapper, moves made on it go through the board's own DoMove methods.
+ */
+template<typename Geometry>
+class BasicMobilityBoard
+{
+    static_assert( !Geometry::HasFlyingKings, "Only pieces within jump distance are updated, flying kings reach further" );
+    static_assert( !Geometry::HasBackwardManCaptures, "Men's jumps are worked out forwards only" );
+
+public:
+    typedef BasicCheckersBoard<Geometry> Board;
+    typedef typename Geometry::Bitboard Bitboard;
+    typedef typename Board::MovePath MovePath;
+    typedef typename Board::MoveList MoveList;
+    typedef typename Board::UndoRecord UndoRecord;
+    typedef typename Board::SideType SideType;
+
+    explicit BasicMobilityBoard( const Board &board );
+
+    const Board& GetBoard() const { return m_board; }
+
+    /// Get all the legal moves that the current side can make, the same moves as Board::GetMoves.
+    void GetMoves( MoveList &moves ) const;
+
+    /// Performs a move that came from GetMoves. The move isn't checked.
+    void DoMoveUnchecked( const PackedMove &move );
+
+    /// Performs a whole move that came from GetMovePaths, see Board::DoMove.
+    void DoMove( const MovePath &movePath, UndoRecord &undoRecord );
+
+    /// Takes back a move made with DoMove.
+    void UndoMove( const UndoRecord &undoRecord );
+
+    /// The number of pieces whose moves were worked out again by the last update.
+    int GetLastUpdateCount() const { return m_lastUpdateCount; }
+
+private:
+    typedef SquareTables<Geometry> Tables;
+
+    /// Works out the moves again for the pieces within jump distance of the changed squares.
+    void Update( Bitboard changed );
+
+    /// Works out the moves of the piece on a square, or clears them if it's empty.
+    void UpdateSquare( int square );
+
+    Board m_board;
+
+    /// The squares each piece can step to, indexed by square.
+    Bitboard m_steps[Geometry::NumberOfPlayableSquares];
+
+    /// The squares each piece can jump to, indexed by square.
+    Bitboard m_jumps[Geometry::NumberOfPlayableSquares];
+
+    /// The squares of the pieces with a step, or a jump, in White, Black order.
+    Bitboard m_steppers[2];
+    Bitboard m_jumpers[2];
+
+    int m_lastUpdateCount;
+};
+
+/// Keeps the moves of a standard board up to date.
+typedef BasicMobilityBoard<Geometry8x8> MobilityBoard;
+
+}
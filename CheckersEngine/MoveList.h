@@ -0,0 +1,118 @@
+#pragma once
+
+#include "BoardGeometry.h"
+#include "MovePath.h"
+#include "PackedMove.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <memory>
+
+namespace checkers {
+
+/**
+ * A list of moves with a fixed capacity stored inline, so that generating moves doesn't allocate.
+ * Capture sequences aren't bounded by any capacity worth keeping inline, so moves past it go to the heap instead of
+ * being dropped. Has the parts of the std::vector interface that move generation and its callers use.
+ */
+template<typename MoveType, int Capacity>
+class FixedMoveList
+{
+public:
+    typedef MoveType value_type;
+    typedef MoveType* iterator;
+    typedef const MoveType* const_iterator;
+
+    FixedMoveList() : m_moves( m_inlineMoves ), m_size( 0 ), m_capacity( Capacity ) {}
+
+    FixedMoveList( const FixedMoveList &rhs ) : m_moves( m_inlineMoves ), m_size( 0 ), m_capacity( Capacity )
+    {
+        *this = rhs;
+    }
+
+    FixedMoveList& operator= ( const FixedMoveList &rhs )
+    {
+        if ( this != &rhs ) {
+            clear();
+            Reserve( rhs.m_size );
+            std::copy( rhs.begin(), rhs.end(), m_moves );
+            m_size = rhs.m_size;
+        }
+        return *this;
+    }
+
+    /// Adds a move. Past the inline capacity the moves are moved to the heap, nothing is ever dropped.
+    void push_back( const MoveType &move )
+    {
+        if ( m_size == m_capacity ) { Reserve( m_capacity * 2 ); }
+        m_moves[m_size++] = move;
+    }
+
+    void pop_back() { assert( m_size > 0 ); m_size--; }
+    void clear() { m_size = 0; }
+
+    int size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    /// The number of moves that fit without allocating again.
+    int capacity() const { return m_capacity; }
+
+    /// Whether the moves outgrew the inline capacity and live on the heap.
+    bool IsOnHeap() const { return m_moves != m_inlineMoves; }
+
+    MoveType& operator[]( int index ) { assert( index < m_size ); return m_moves[index]; }
+    const MoveType& operator[]( int index ) const { assert( index < m_size ); return m_moves[index]; }
+
+    MoveType& back() { assert( m_size > 0 ); return m_moves[m_size - 1]; }
+    const MoveType& back() const { assert( m_size > 0 ); return m_moves[m_size - 1]; }
+
+    iterator begin() { return m_moves; }
+    iterator end() { return m_moves + m_size; }
+    const_iterator begin() const { return m_moves; }
+    const_iterator end() const { return m_moves + m_size; }
+
+private:
+    void Reserve( int capacity )
+    {
+        if ( capacity <= m_capacity ) { return; }
+        std::unique_ptr<MoveType[]> heapMoves( new MoveType[capacity] );
+        std::copy( m_moves, m_moves + m_size, heapMoves.get() );
+        m_heapMoves = std::move( heapMoves );
+        m_moves = m_heapMoves.get();
+        m_capacity = capacity;
+    }
+
+    MoveType m_inlineMoves[Capacity];
+    std::unique_ptr<MoveType[]> m_heapMoves;
+    MoveType *m_moves;
+    int m_size;
+    int m_capacity;
+};
+
+/// The move lists of a board geometry.
+template<typename Geometry>
+struct MoveLists
+{
+    /// Hop-level moves, as made by GetMoves and GetJumpMoves.
+    typedef FixedMoveList<PackedMove, Geometry::MaxMoves> MoveList;
+
+    /// Whole moves, as made by GetMovePaths.
+    typedef FixedMoveList<BasicMovePath<Geometry>, Geometry::MaxMovePaths> MovePathList;
+};
+
+/// Each of the 12 pieces can make at most 4 single steps or 4 single jumps.
+const int MaxMoves = Geometry8x8::MaxMoves;
+
+/**
+ * Simple moves are bounded by MaxMoves, but capture sequences branch.
+ * No 8x8 position found comes close to this many complete moves, the list grows onto the heap if one does.
+ */
+const int MaxMovePaths = Geometry8x8::MaxMovePaths;
+
+/// Hop-level moves on the standard board.
+typedef MoveLists<Geometry8x8>::MoveList MoveList;
+
+/// Whole moves on the standard board.
+typedef MoveLists<Geometry8x8>::MovePathList MovePathList;
+
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Bitboard.h"
+#include "BoardGeometry.h"
+#include "Move.h"
+
+#include <assert.h>
+#include <cstdint>
+
+namespace checkers {
+
+/**
+ * A whole turn: either a simple move or a complete capture sequence.
+ * Holds every square the piece lands on and the mask of all the pieces it captures, so it can be applied in one go.
+ */
+template<typename Geometry>
+struct BasicMovePath
+{
+    typedef typename Geometry::Bitboard Bitboard;
+
+    /// The start square plus one landing for each of the opponent's pieces.
+    static const int MaxSquares = Geometry::NumberOfStartingPieces + 1;
+
+    /// The start square followed by each landing square, as square indices.
+    uint8_t squares[MaxSquares];
+
+    /// The number of used entries in squares, 0 for an empty path.
+    uint8_t squareCount;
+
+    /// The opponent pieces removed by this move.
+    Bitboard captured;
+
+    int GetFrom() const { assert( squareCount > 0 ); return squares[0]; }
+    int GetTo() const { assert( squareCount > 0 ); return squares[squareCount - 1]; }
+
+    bool IsCapture() const { return captured != 0; }
+
+    /// The number of single steps or jumps in the move.
+    int GetHopCount() const { return squareCount > 0 ? squareCount - 1 : 0; }
+
+    /// Get a single step or jump of the move. Playing every hop in order with CheckersBoard::DoMove plays the whole move.
+    Move GetHop( int hop ) const
+    {
+        assert( hop < GetHopCount() );
+        return Move{ Geometry::SquareToPos( squares[hop] ), Geometry::SquareToPos( squares[hop + 1] ) };
+    }
+
+    /// Returns the first hop of the move, or a default Move for an empty path.
+    Move GetFirstHop() const { return GetHopCount() > 0 ? GetHop( 0 ) : Move{}; }
+
+    void AddSquare( int square )
+    {
+        assert( squareCount < MaxSquares );
+        squares[squareCount++] = static_cast<uint8_t>( square );
+    }
+
+    void RemoveLastSquare()
+    {
+        assert( squareCount > 0 );
+        squareCount--;
+    }
+
+    /// Whether both moves go from and to the same squares and capture the same pieces, whichever way they went.
+    bool IsSameMove( const BasicMovePath &rhs ) const
+    {
+        return GetFrom() == rhs.GetFrom() && GetTo() == rhs.GetTo() && captured == rhs.captured;
+    }
+
+    bool operator== ( const BasicMovePath &rhs ) const
+    {
+        if ( squareCount != rhs.squareCount || captured != rhs.captured ) { return false; }
+        for ( int i = 0; i < squareCount; i++ ) {
+            if ( squares[i] != rhs.squares[i] ) { return false; }
+        }
+        return true;
+    }
+
+    bool operator!= ( const BasicMovePath &rhs ) const
+    {
+        return !( *this == rhs );
+    }
+};
+
+template<typename Geometry> const int BasicMovePath<Geometry>::MaxSquares;
+
+/// A whole turn on the standard board.
+typedef BasicMovePath<Geometry8x8> MovePath;
+
+}
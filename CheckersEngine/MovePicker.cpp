@@ -0,0 +1,94 @@
+#include "MovePicker.h"
+
+#include <algorithm>
+
+using namespace checkers;
+
+const int MoveHistory::KillersPerPly;
+const int MoveHistory::MaxPly;
+const int MoveHistory::MaxScore;
+const int MovePicker::Picked;
+
+void MoveHistory::Clear()
+{
+    std::fill( &m_killers[0][0], &m_killers[0][0] + MaxPly * KillersPerPly, -1 );
+    std::fill( &m_scores[0][0], &m_scores[0][0] + 2 * CheckersBoard::NumberOfSquares * CheckersBoard::NumberOfSquares, 0 );
+}
+
+void MoveHistory::AddCutoff( const MovePath &movePath, CheckersBoard::SideType side, int ply, int depth )
+{
+    int key = GetKey( movePath );
+    if ( ply < MaxPly && m_killers[ply][0] != key ) {
+        m_killers[ply][1] = m_killers[ply][0];
+        m_killers[ply][0] = key;
+    }
+
+    int &score = m_scores[static_cast<int>( side )][key];
+    score += std::max( depth, 1 ) * std::max( depth, 1 );
+    if ( score > MaxScore ) {
+        for ( auto &sideScores : m_scores ) {
+            for ( auto &sideScore : sideScores ) {
+                sideScore /= 2;
+            }
+        }
+    }
+}
+
+MovePicker::MovePicker( const CheckersBoard &board, const MovePathList &movePaths, int hashMoveIndex, const MoveHistory &history, int ply ) :
+    m_movePaths( movePaths ),
+    m_hashMoveIndex( hashMoveIndex ),
+    m_history( history ),
+    m_ply( ply ),
+    m_stage( Stage::HashMove ),
+    m_killerSlot( 0 )
+{
+    // Taking a king is worth more than taking a man, but taking two pieces is worth more than either.
+    Bitboard kings = board.GetKings();
+    for ( int i = 0; i < movePaths.size(); i++ ) {
+        const MovePath &movePath = movePaths[i];
+        m_scores[i] = movePath.IsCapture() ? PopCount( movePath.captured ) * 4 + PopCount( movePath.captured & kings ) :
+                                             history.GetScore( movePath, board.GetCurrentSide() );
+    }
+
+    // Captures have no killers.
+    if ( !movePaths.empty() && movePaths[0].IsCapture() ) { m_killerSlot = MoveHistory::KillersPerPly; }
+}
+
+int MovePicker::Next()
+{
+    if ( m_stage == Stage::HashMove ) {
+        m_stage = Stage::Killers;
+        if ( m_hashMoveIndex >= 0 && m_hashMoveIndex < m_movePaths.size() ) {
+            m_scores[m_hashMoveIndex] = Picked;
+            return m_hashMoveIndex;
+        }
+    }
+
+    if ( m_stage == Stage::Killers ) {
+        for ( ; m_killerSlot < MoveHistory::KillersPerPly; m_killerSlot++ ) {
+            for ( int i = 0; i < m_movePaths.size(); i++ ) {
+                if ( m_scores[i] != Picked && m_history.IsKiller( m_movePaths[i], m_ply, m_killerSlot ) ) {
+                    m_scores[i] = Picked;
+                    m_killerSlot++;
+                    return i;
+                }
+            }
+        }
+        m_stage = Stage::Remaining;
+    }
+
+    return PickBest();
+}
+
+int MovePicker::PickBest()
+{
+    // Ties go to the first generated, so the order is repeatable.
+    int bestIndex = -1;
+    for ( int i = 0; i < m_movePaths.size(); i++ ) {
+        if ( m_scores[i] != Picked && ( bestIndex < 0 || m_scores[i] > m_scores[bestIndex] ) ) {
+            bestIndex = i;
+        }
+    }
+    if ( bestIndex >= 0 ) { m_scores[bestIndex] = Picked; }
+    return bestIndex;
+}
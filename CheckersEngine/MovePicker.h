@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CheckersBoard.h"
+#include "MoveList.h"
+#include "MovePath.h"
+
+#include <climits>
+
+namespace checkers {
+
+/**
+ * What a search has learnt about which quiet moves are good, from the moves that caused cutoffs.
+ * Killer moves are the last two quiet moves to cause a cutoff at each ply, as a move that refutes one line often
+ * refutes its siblings too. The history score of a move, by side and from and to square, adds up the cutoffs it
+ * caused anywhere in the tree, weighted towards the deeper searches.
+ *
+ * Each search has its own, so search threads never share them.
+ */
+class MoveHistory
+{
+public:
+    static const int KillersPerPly = 2;
+
+    /// Killers are kept for plies below this.
+    static const int MaxPly = 128;
+
+    /// Scores are halved once one gets this high, so recent cutoffs count for more than old ones.
+    static const int MaxScore = 1 << 20;
+
+    MoveHistory() { Clear(); }
+
+    void Clear();
+
+    /// Records that a quiet move caused a beta cutoff at ply, in a search to depth.
+    void AddCutoff( const MovePath &movePath, CheckersBoard::SideType side, int ply, int depth );
+
+    /// Returns whether a quiet move is one of the killers at ply.
+    bool IsKiller( const MovePath &movePath, int ply, int killerSlot ) const
+    {
+        return ply < MaxPly && m_killers[ply][killerSlot] == GetKey( movePath );
+    }
+
+    int GetScore( const MovePath &movePath, CheckersBoard::SideType side ) const
+    {
+        return m_scores[static_cast<int>( side )][GetKey( movePath )];
+    }
+
+private:
+    /// A quiet move is one step, its from and to squares say which it is.
+    static int GetKey( const MovePath &movePath ) { return movePath.GetFrom() * CheckersBoard::NumberOfSquares + movePath.GetTo(); }
+
+    int m_killers[MaxPly][KillersPerPly];
+    int m_scores[2][CheckersBoard::NumberOfSquares * CheckersBoard::NumberOfSquares];
+};
+
+/**
+ * Hands out a node's moves in the order the search should try them, in stages:
+ * the transposition table's best move, then the captures with the most and most valuable pieces taken first, then
+ * the killer moves, then the other quiet moves by history score. Captures are forced, so a node has captures or
+ * quiet moves, never both.
+ *
+ * Moves are picked one at a time, so a node that cuts off on its first move never sorts the rest.
+ */
+class MovePicker
+{
+public:
+    /// hashMoveIndex is an index into movePaths, -1 for none. The list and history must outlive the picker.
+    MovePicker( const CheckersBoard &board, const MovePathList &movePaths, int hashMoveIndex, const MoveHistory &history, int ply );
+
+    /// Returns the index in movePaths of the next move to try, -1 once they've all been picked.
+    int Next();
+
+private:
+    enum class Stage { HashMove, Killers, Remaining };
+
+    static const int Picked = INT_MIN;
+
+    /// The highest scored move not yet picked, -1 if there are none.
+    int PickBest();
+
+    const MovePathList &m_movePaths;
+    int m_hashMoveIndex;
+    const MoveHistory &m_history;
+    int m_ply;
+    Stage m_stage;
+    int m_killerSlot;
+
+    /// Capture value or history score of each move, Picked once it's been handed out.
+    int m_scores[Geometry8x8::MaxMovePaths];
+};
+
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Bitboard.h"
+#include "BoardGeometry.h"
+#include "Move.h"
+#include "SquareTables.h"
+
+#include <assert.h>
+#include <cstdint>
+
+namespace checkers {
+
+/**
+ * A single step or jump packed into 16 bits: the from and to squares as 6 bit square indices, a jump flag and the direction.
+ * Used wherever many moves are stored. Converts to and from the Pos based Move, which can also describe illegal moves.
+ * Square indices fit every board geometry up to 64 playable squares, the Pos conversions need to know the geometry.
+ */
+class PackedMove
+{
+public:
+    /// An empty move, from square 0 to square 0.
+    PackedMove() : m_data( 0 ) {}
+
+    PackedMove( int from, int to, Direction direction, bool isJump ) :
+        m_data( static_cast<uint16_t>( from | ( to << ToShift ) | ( isJump ? JumpFlag : 0 ) |
+                                       ( static_cast<int>( direction ) << DirectionShift ) ) )
+    {
+        assert( from >= 0 && from <= SquareMaskBits );
+        assert( to >= 0 && to <= SquareMaskBits );
+    }
+
+    /// Packs a Pos based move on the standard board. The move must be a diagonal step or jump between playable squares.
+    explicit PackedMove( const Move &move ) : m_data( FromMove<Geometry8x8>( move ).m_data ) {}
+
+    /// Packs a Pos based move on a board of the given geometry. A longer slide of a flying king is packed as a step.
+    template<typename Geometry>
+    static PackedMove FromMove( const Move &move )
+    {
+        assert( move.IsAdjacentMove() || move.IsJumpMove() || ( Geometry::HasFlyingKings && move.from.IsDiagonal( move.to ) ) );
+        bool isUp = move.to.row > move.from.row;
+        bool isRight = move.to.column > move.from.column;
+        Direction direction = isUp ? ( isRight ? Direction::UpRight : Direction::UpLeft ) :
+                                     ( isRight ? Direction::DownRight : Direction::DownLeft );
+        return PackedMove( Geometry::PosToSquare( move.from ), Geometry::PosToSquare( move.to ), direction, move.IsJumpMove() );
+    }
+
+    int GetFrom() const { return m_data & SquareMaskBits; }
+    int GetTo() const { return ( m_data >> ToShift ) & SquareMaskBits; }
+    bool IsJump() const { return ( m_data & JumpFlag ) != 0; }
+    Direction GetDirection() const { return static_cast<Direction>( ( m_data >> DirectionShift ) & 3 ); }
+
+    /// The square of the piece being jumped, for a single jump. A flying king's jump depends on the board, see CheckersBoard.
+    template<typename Geometry = Geometry8x8>
+    int GetJumpedSquare() const
+    {
+        assert( IsJump() );
+        return SquareTables<Geometry>::GetNeighbourSquare( GetFrom(), GetDirection() );
+    }
+
+    /// The packed bits, for storing in tables.
+    uint16_t GetData() const { return m_data; }
+
+    /// Unpacks to the Pos based move on a board of the given geometry.
+    template<typename Geometry>
+    Move ToMove() const
+    {
+        return Move{ Geometry::SquareToPos( GetFrom() ), Geometry::SquareToPos( GetTo() ) };
+    }
+
+    /// Unpacks to the Pos based move on the standard board.
+    operator Move() const
+    {
+        return ToMove<Geometry8x8>();
+    }
+
+    bool operator== ( const PackedMove &rhs ) const
+    {
+        return m_data == rhs.m_data;
+    }
+
+    bool operator!= ( const PackedMove &rhs ) const
+    {
+        return !( *this == rhs );
+    }
+
+private:
+    static const int ToShift = 6;
+    static const int SquareMaskBits = 0x3F;
+    static const int JumpFlag = 1 << 12;
+    static const int DirectionShift = 13;
+
+    uint16_t m_data;
+};
+
+}
@@ -0,0 +1,150 @@
+#include "Perft.h"
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+using namespace checkers;
+
+const int Perft::NumberOfStartPositionCounts;
+
+const uint64_t Perft::StartPositionCounts[NumberOfStartPositionCounts] = {
+    7, 49, 302, 1469, 7361, 36768, 179740, 845931, 3963680, 18391564, 85242128, 388623673
+};
+
+namespace {
+
+/// Subtree counts keyed by position hash and depth. Entries are overwritten on collision.
+class PerftHashTable
+{
+public:
+    explicit PerftHashTable( size_t sizeBytes ) :
+        m_entries( std::max<size_t>( sizeBytes / sizeof( Entry ), 1 ) )
+    {}
+
+    bool Find( uint64_t hash, int depth, uint64_t &nodes ) const
+    {
+        const Entry &entry = m_entries[hash % m_entries.size()];
+        if ( entry.hash != hash || entry.depth != depth ) { return false; }
+        nodes = entry.nodes;
+        return true;
+    }
+
+    void Store( uint64_t hash, int depth, uint64_t nodes )
+    {
+        Entry &entry = m_entries[hash % m_entries.size()];
+        entry.hash = hash;
+        entry.depth = depth;
+        entry.nodes = nodes;
+    }
+
+private:
+    struct Entry
+    {
+        Entry() : hash( 0 ), nodes( 0 ), depth( 0 ) {}
+
+        uint64_t hash;
+        uint64_t nodes : 56;
+        uint64_t depth : 8;
+    };
+
+    std::vector<Entry> m_entries;
+};
+
+/// Recursive count, making and undoing moves in place on one board.
+class PerftCounter
+{
+public:
+    PerftCounter( bool isBulkCounting, PerftHashTable *hashTable ) :
+        m_isBulkCounting( isBulkCounting ),
+        m_hashTable( hashTable )
+    {}
+
+    uint64_t Count( CheckersBoard &board, int depth )
+    {
+        if ( depth <= 0 ) { return depth == 0 ? 1 : 0; }
+
+        MovePathList movePaths;
+        board.GetMovePaths( movePaths );
+        if ( depth == 1 && m_isBulkCounting ) { return movePaths.size(); }
+
+        // Depth 1 entries would cost more to look up than to count.
+        uint64_t nodes = 0;
+        bool isHashed = m_hashTable != nullptr && depth > 1;
+        if ( isHashed && m_hashTable->Find( board.GetHash(), depth, nodes ) ) { return nodes; }
+
+        CheckersBoard::UndoRecord undoRecord;
+        for ( auto &movePath : movePaths ) {
+            board.DoMove( movePath, undoRecord );
+            nodes += Count( board, depth - 1 );
+            board.UndoMove( undoRecord );
+        }
+
+        if ( isHashed ) { m_hashTable->Store( board.GetHash(), depth, nodes ); }
+        return nodes;
+    }
+
+private:
+    bool m_isBulkCounting;
+    PerftHashTable *m_hashTable;
+};
+
+}
+
+uint64_t Perft::Count( const CheckersBoard &board, int depth )
+{
+    CheckersBoard countBoard = board;
+    return PerftCounter( true, nullptr ).Count( countBoard, depth );
+}
+
+Perft::Result Perft::Run( const CheckersBoard &board, int depth, const Options &options )
+{
+    auto startTime = std::chrono::steady_clock::now();
+
+    Result result;
+    result.nodes = 0;
+
+    MovePathList movePaths;
+    if ( depth > 0 ) { board.GetMovePaths( movePaths ); }
+    for ( auto &movePath : movePaths ) {
+        result.divide.push_back( DivideEntry{ movePath, 0 } );
+    }
+
+    // Each task takes the next root move that hasn't been counted, so a slow subtree doesn't hold up the others.
+    std::atomic<int> nextRootMove( 0 );
+    auto countRootMoves = [&]( size_t hashSizeBytes ) {
+        std::unique_ptr<PerftHashTable> hashTable;
+        if ( hashSizeBytes > 0 ) { hashTable.reset( new PerftHashTable( hashSizeBytes ) ); }
+        PerftCounter counter( options.isBulkCounting, hashTable.get() );
+
+        for ( int i = nextRootMove++; i < static_cast<int>( result.divide.size() ); i = nextRootMove++ ) {
+            CheckersBoard childBoard = board;
+            childBoard.DoMoveUnchecked( result.divide[i].move );
+            result.divide[i].nodes = counter.Count( childBoard, depth - 1 );
+        }
+    };
+
+    int threadCount = std::max( 1, std::min( options.threadCount, movePaths.size() ) );
+    size_t hashSizeBytes = static_cast<size_t>( options.hashSizeMB ) * 1024 * 1024 / threadCount;
+    if ( threadCount == 1 ) {
+        countRootMoves( hashSizeBytes );
+    }
+    else {
+        TaskGroup taskGroup;
+        for ( int i = 0; i < threadCount; i++ ) {
+            taskGroup.Run( [&]() { countRootMoves( hashSizeBytes ); } );
+        }
+        taskGroup.Wait();
+    }
+
+    for ( auto &entry : result.divide ) {
+        result.nodes += entry.nodes;
+    }
+    if ( depth == 0 ) { result.nodes = 1; }
+
+    result.seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - startTime ).count();
+    return result;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CheckersBoard.h"
+#include "MovePath.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace checkers {
+
+/**
+ * Counts the positions at a fixed depth of the move tree, to check and time the move generator.
+ * A capture sequence is one move, so the counts match the published 8x8 checkers perft numbers.
+ */
+class Perft
+{
+public:
+    struct Options
+    {
+        Options() : isBulkCounting( true ), hashSizeMB( 0 ), threadCount( 1 ) {}
+
+        /// Count the moves at the last ply instead of making each of them.
+        bool isBulkCounting;
+
+        /// Size of the transposition table that caches subtree counts, 0 for none. Each thread gets its own share.
+        int hashSizeMB;
+
+        /// The root moves are shared out between this many tasks on the engine's ThreadPool.
+        int threadCount;
+    };
+
+    /// The count below one root move.
+    struct DivideEntry
+    {
+        MovePath move;
+        uint64_t nodes;
+    };
+
+    struct Result
+    {
+        uint64_t nodes;
+        double seconds;
+
+        /// One entry per root move, in GetMovePaths order.
+        std::vector<DivideEntry> divide;
+
+        uint64_t GetNodesPerSecond() const { return seconds > 0 ? static_cast<uint64_t>( nodes / seconds ) : 0; }
+    };
+
+    /// The number of published counts from the start position.
+    static const int NumberOfStartPositionCounts = 12;
+
+    /// Published counts from the start position, indexed by depth - 1.
+    static const uint64_t StartPositionCounts[NumberOfStartPositionCounts];
+
+    /// Counts the positions depth moves from the board, single threaded with bulk counting. There are none at a negative depth.
+    static uint64_t Count( const CheckersBoard &board, int depth );
+
+    /// Counts the positions depth moves from the board, divided by root move, and times the count. There are none at a negative depth.
+    static Result Run( const CheckersBoard &board, int depth, const Options &options = Options() );
+};
+
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Bitboard.h"
+#include "BoardGeometry.h"
+#include "SquareTables.h"
+
+namespace checkers {
+
+namespace SquareGeometry {
+
+    /// The squares that are still on the board after moving a number of steps in the direction.
+    template<typename Geometry>
+    constexpr typename Geometry::Bitboard GetStepSourceMask( int direction, int steps, int square = 0 )
+    {
+        return square >= Geometry::NumberOfPlayableSquares ? 0 :
+               ( GetStepSquare<Geometry>( square * NumberOfDirections + direction, steps ) < 0 ? 0 : Geometry::GetSquareMask( square ) ) |
+               GetStepSourceMask<Geometry>( direction, steps, square + 1 );
+    }
+}
+
+/**
+ * Slides along whole diagonals, for flying kings.
+ * Rays are filled with Kogge-Stone occluded fills: each stage doubles the distance covered, so a fill is the same
+ * few shifts whatever the length of the ray, without loops over squares or branches. They work on any number of
+ * pieces at once, so the pieces with a capture are found for the whole board in one go.
+ *
+ * A single step shifts even and odd rows by different amounts, but an even number of steps moves every square by
+ * the same amount, so the longer stages are one masked shift.
+ */
+template<typename Geometry>
+struct RayAttacks
+{
+    typedef typename Geometry::Bitboard Bitboard;
+
+    /// Moves every square a number of diagonal steps in the direction, either 1 or 2, 4 or 8 steps.
+    static Bitboard Shift( Bitboard board, Direction direction, int steps )
+    {
+        if ( steps == 1 ) { return Geometry::Shift( board, direction ); }
+
+        // Up right and down left move a whole row pair and one square more, the other two one square less.
+        int index = static_cast<int>( direction );
+        int distance = ( steps / 2 ) * ( index == 0 || index == 3 ? 2 * Geometry::SquaresPerRow + 1 : 2 * Geometry::SquaresPerRow - 1 );
+        board &= StepSourceMasks[( steps / 4 ) * NumberOfDirections + index];
+        return index < 2 ? board << distance : board >> distance;
+    }
+
+    /**
+     * Every square reached by sliding from the generator squares through the propagator squares in the direction,
+     * the generator squares included. A slide stops before the first square that isn't a propagator.
+     */
+    static Bitboard OccludedFill( Bitboard generator, Bitboard propagator, Direction direction )
+    {
+        for ( int steps = 1; steps <= Geometry::MaxRayLength; steps *= 2 ) {
+            generator |= propagator & Shift( generator, direction, steps );
+            propagator &= Shift( propagator, direction, steps );
+        }
+        return generator;
+    }
+
+    /// The empty squares the pieces can slide to in the direction.
+    static Bitboard GetSlides( Bitboard pieces, Bitboard empty, Direction direction )
+    {
+        return OccludedFill( pieces, empty, direction ) & ~pieces;
+    }
+
+    /// The first square that isn't empty along the direction from each of the pieces.
+    static Bitboard GetFirstBlockers( Bitboard pieces, Bitboard empty, Direction direction )
+    {
+        return Geometry::Shift( OccludedFill( pieces, empty, direction ), direction ) & ~empty;
+    }
+
+    /// The opponent pieces that can be captured in the direction: the first piece along a ray, with an empty square behind it.
+    static Bitboard GetCaptureTargets( Bitboard pieces, Bitboard empty, Bitboard opponents, Direction direction )
+    {
+        return GetFirstBlockers( pieces, empty, direction ) & opponents & Geometry::Shift( empty, GetOppositeDirection( direction ) );
+    }
+
+    /// The squares a capture in the direction can land on, every empty square behind the captured piece up to the next piece.
+    static Bitboard GetCaptureLandings( Bitboard pieces, Bitboard empty, Bitboard opponents, Direction direction )
+    {
+        return OccludedFill( Geometry::Shift( GetCaptureTargets( pieces, empty, opponents, direction ), direction ), empty, direction );
+    }
+
+    /// Which of the pieces have a capture in the direction. Looks back from every opponent that could be captured.
+    static Bitboard GetCapturers( Bitboard pieces, Bitboard empty, Bitboard opponents, Direction direction )
+    {
+        Direction backwards = GetOppositeDirection( direction );
+        Bitboard targets = opponents & Geometry::Shift( empty, backwards );
+        return GetFirstBlockers( targets, empty, backwards ) & pieces;
+    }
+
+private:
+    /// The squares that stay on the board for 2, 4 and 8 steps, indexed by ( steps / 4 ) * NumberOfDirections + direction.
+    static constexpr Bitboard StepSourceMasks[3 * NumberOfDirections] = {
+        SquareGeometry::GetStepSourceMask<Geometry>( 0, 2 ), SquareGeometry::GetStepSourceMask<Geometry>( 1, 2 ),
+        SquareGeometry::GetStepSourceMask<Geometry>( 2, 2 ), SquareGeometry::GetStepSourceMask<Geometry>( 3, 2 ),
+        SquareGeometry::GetStepSourceMask<Geometry>( 0, 4 ), SquareGeometry::GetStepSourceMask<Geometry>( 1, 4 ),
+        SquareGeometry::GetStepSourceMask<Geometry>( 2, 4 ), SquareGeometry::GetStepSourceMask<Geometry>( 3, 4 ),
+        SquareGeometry::GetStepSourceMask<Geometry>( 0, 8 ), SquareGeometry::GetStepSourceMask<Geometry>( 1, 8 ),
+        SquareGeometry::GetStepSourceMask<Geometry>( 2, 8 ), SquareGeometry::GetStepSourceMask<Geometry>( 3, 8 ),
+    };
+};
+
+template<typename Geometry> constexpr typename Geometry::Bitboard RayAttacks<Geometry>::StepSourceMasks[3 * NumberOfDirections];
+
+}
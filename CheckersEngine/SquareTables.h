@@ -0,0 +1,160 @@
+#pragma once
+
+#include "Bitboard.h"
+#include "BoardGeometry.h"
+
+#include <cstdint>
+
+namespace checkers {
+
+/**
+ * Compile time tables of the square geometry, so the move generator and validator use lookups instead of Pos arithmetic.
+ * All the tables are constexpr, they're built by the compiler for each board geometry and cost nothing at startup.
+ * Entries are indexed by square * NumberOfDirections + direction.
+ */
+namespace SquareGeometry {
+
+    // Direction order is UpRight, UpLeft, DownRight, DownLeft.
+    constexpr int GetRowDelta( int direction ) { return direction < 2 ? 1 : -1; }
+    constexpr int GetColumnDelta( int direction ) { return direction % 2 == 0 ? 1 : -1; }
+
+    /// The square a number of diagonal steps away, or -1 if it's off the board.
+    template<typename Geometry>
+    constexpr int GetStepSquare( int entry, int steps )
+    {
+        return Geometry::GetSquare( Geometry::GetRow( entry / NumberOfDirections ) + GetRowDelta( entry % NumberOfDirections ) * steps,
+                                    Geometry::GetColumn( entry / NumberOfDirections ) + GetColumnDelta( entry % NumberOfDirections ) * steps );
+    }
+
+    /// The square and every square within jump distance of it, along the diagonals.
+    template<typename Geometry>
+    constexpr typename Geometry::Bitboard GetJumpDistanceMask( int square )
+    {
+        return Geometry::GetSquareMask( square ) |
+               Geometry::GetSquareMask( GetStepSquare<Geometry>( square * NumberOfDirections + 0, 1 ) ) |
+               Geometry::GetSquareMask( GetStepSquare<Geometry>( square * NumberOfDirections + 1, 1 ) ) |
+               Geometry::GetSquareMask( GetStepSquare<Geometry>( square * NumberOfDirections + 2, 1 ) ) |
+               Geometry::GetSquareMask( GetStepSquare<Geometry>( square * NumberOfDirections + 3, 1 ) ) |
+               Geometry::GetSquareMask( GetStepSquare<Geometry>( square * NumberOfDirections + 0, 2 ) ) |
+               Geometry::GetSquareMask( GetStepSquare<Geometry>( square * NumberOfDirections + 1, 2 ) ) |
+               Geometry::GetSquareMask( GetStepSquare<Geometry>( square * NumberOfDirections + 2, 2 ) ) |
+               Geometry::GetSquareMask( GetStepSquare<Geometry>( square * NumberOfDirections + 3, 2 ) );
+    }
+
+    // C++11 has no std::index_sequence.
+    template<int... Indices> struct IndexSequence {};
+    template<int N, int... Indices> struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, Indices...> {};
+    template<int... Indices> struct MakeIndexSequence<0, Indices...> { typedef IndexSequence<Indices...> Type; };
+
+    template<typename Geometry, typename Sequence> struct Tables;
+
+    template<typename Geometry, int... Entries>
+    struct Tables< Geometry, IndexSequence<Entries...> >
+    {
+        typedef typename Geometry::Bitboard Bitboard;
+
+        /// The square one step away, also the square being jumped.
+        static constexpr int8_t Neighbours[sizeof...( Entries )] = { static_cast<int8_t>( GetStepSquare<Geometry>( Entries, 1 ) )... };
+
+        /// The square a jump lands on.
+        static constexpr int8_t JumpLandings[sizeof...( Entries )] = { static_cast<int8_t>( GetStepSquare<Geometry>( Entries, 2 ) )... };
+
+        static constexpr Bitboard NeighbourMasks[sizeof...( Entries )] = { Geometry::GetSquareMask( GetStepSquare<Geometry>( Entries, 1 ) )... };
+        static constexpr Bitboard JumpLandingMasks[sizeof...( Entries )] = { Geometry::GetSquareMask( GetStepSquare<Geometry>( Entries, 2 ) )... };
+    };
+
+    template<typename Geometry, int... Entries> constexpr int8_t Tables< Geometry, IndexSequence<Entries...> >::Neighbours[sizeof...( Entries )];
+    template<typename Geometry, int... Entries> constexpr int8_t Tables< Geometry, IndexSequence<Entries...> >::JumpLandings[sizeof...( Entries )];
+    template<typename Geometry, int... Entries>
+    constexpr typename Geometry::Bitboard Tables< Geometry, IndexSequence<Entries...> >::NeighbourMasks[sizeof...( Entries )];
+    template<typename Geometry, int... Entries>
+    constexpr typename Geometry::Bitboard Tables< Geometry, IndexSequence<Entries...> >::JumpLandingMasks[sizeof...( Entries )];
+
+    /// Tables indexed by square only.
+    template<typename Geometry, typename Sequence> struct SquareMaskTables;
+
+    template<typename Geometry, int... Squares>
+    struct SquareMaskTables< Geometry, IndexSequence<Squares...> >
+    {
+        /// The squares whose moves can change when this square changes.
+        static constexpr typename Geometry::Bitboard JumpDistanceMasks[sizeof...( Squares )] = { GetJumpDistanceMask<Geometry>( Squares )... };
+    };
+
+    template<typename Geometry, int... Squares>
+    constexpr typename Geometry::Bitboard SquareMaskTables< Geometry, IndexSequence<Squares...> >::JumpDistanceMasks[sizeof...( Squares )];
+}
+
+/// The lookups of a board geometry.
+template<typename Geometry>
+struct SquareTables :
+    SquareGeometry::Tables< Geometry, typename SquareGeometry::MakeIndexSequence<Geometry::NumberOfPlayableSquares * NumberOfDirections>::Type >,
+    SquareGeometry::SquareMaskTables< Geometry, typename SquareGeometry::MakeIndexSequence<Geometry::NumberOfPlayableSquares>::Type >
+{
+    typedef typename Geometry::Bitboard Bitboard;
+
+    /// The square one diagonal step away, which is also the square being jumped. -1 when the step leaves the board.
+    static int GetNeighbourSquare( int square, Direction direction )
+    {
+        return SquareTables::Neighbours[square * NumberOfDirections + static_cast<int>( direction )];
+    }
+
+    /// The square a jump lands on. -1 when the jump leaves the board.
+    static int GetJumpSquare( int square, Direction direction )
+    {
+        return SquareTables::JumpLandings[square * NumberOfDirections + static_cast<int>( direction )];
+    }
+
+    /// The mask of the square one diagonal step away, 0 when the step leaves the board.
+    static Bitboard GetNeighbourMask( int square, Direction direction )
+    {
+        return SquareTables::NeighbourMasks[square * NumberOfDirections + static_cast<int>( direction )];
+    }
+
+    /// The mask of the square a jump lands on, 0 when the jump leaves the board.
+    static Bitboard GetJumpMask( int square, Direction direction )
+    {
+        return SquareTables::JumpLandingMasks[square * NumberOfDirections + static_cast<int>( direction )];
+    }
+
+    /// The square and every square within jump distance of it. A piece's moves only depend on the squares in its mask.
+    static Bitboard GetJumpDistanceMask( int square )
+    {
+        return SquareTables::JumpDistanceMasks[square];
+    }
+
+    /// The row where the men moving up, or down, are crowned.
+    static Bitboard GetPromotionRow( bool isMovingUp )
+    {
+        return isMovingUp ? Geometry::GetLastRow() : Geometry::GetFirstRow();
+    }
+};
+
+static_assert( SquareTables<Geometry8x8>::Neighbours[0] == 5 && SquareTables<Geometry8x8>::Neighbours[1] == 4, "Square 0 steps up to squares 5 and 4" );
+static_assert( SquareTables<Geometry8x8>::JumpLandings[31 * NumberOfDirections + 3] == 22, "Square 31 jumps down left to square 22" );
+static_assert( SquareTables<Geometry10x10>::Neighbours[0] == 6 && SquareTables<Geometry10x10>::Neighbours[1] == 5, "Square 0 steps up to squares 6 and 5" );
+
+/// The square one diagonal step away on the standard board. -1 when the step leaves the board.
+inline int GetNeighbourSquare( int square, Direction direction )
+{
+    return SquareTables<Geometry8x8>::GetNeighbourSquare( square, direction );
+}
+
+/// The square a jump lands on on the standard board. -1 when the jump leaves the board.
+inline int GetJumpSquare( int square, Direction direction )
+{
+    return SquareTables<Geometry8x8>::GetJumpSquare( square, direction );
+}
+
+/// The mask of the square one diagonal step away on the standard board, 0 when the step leaves the board.
+inline Bitboard GetNeighbourMask( int square, Direction direction )
+{
+    return SquareTables<Geometry8x8>::GetNeighbourMask( square, direction );
+}
+
+/// The mask of the square a jump lands on on the standard board, 0 when the jump leaves the board.
+inline Bitboard GetJumpMask( int square, Direction direction )
+{
+    return SquareTables<Geometry8x8>::GetJumpMask( square, direction );
+}
+
+}
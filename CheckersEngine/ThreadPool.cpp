@@ -0,0 +1,180 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+#if defined( _WIN32 )
+#include <windows.h>
+#elif defined( __linux__ )
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace checkers;
+
+namespace {
+
+/// The pool and worker index of a worker thread, so tasks it submits go on its own deque.
+thread_local const void *t_workerPool = nullptr;
+thread_local int t_workerIndex = -1;
+
+std::mutex s_instanceMutex;
+std::unique_ptr<ThreadPool> s_instance;
+int s_instanceWorkerCount = 0;
+bool s_isInstancePinningThreads = false;
+
+void PinThread( std::thread &thread, int cpu )
+{
+#if defined( _WIN32 )
+    SetThreadAffinityMask( thread.native_handle(), static_cast<DWORD_PTR>( 1 ) << ( cpu % ( sizeof( DWORD_PTR ) * 8 ) ) );
+#elif defined( __linux__ )
+    cpu_set_t cpuSet;
+    CPU_ZERO( &cpuSet );
+    CPU_SET( cpu % CPU_SETSIZE, &cpuSet );
+    pthread_setaffinity_np( thread.native_handle(), sizeof( cpuSet ), &cpuSet );
+#else
+    (void)thread;
+    (void)cpu;
+#endif
+}
+
+}
+
+ThreadPool::ThreadPool( int workerCount, bool isPinningThreads ) :
+    m_queuedTaskCount( 0 ),
+    m_nextWorker( 0 ),
+    m_isStopping( false )
+{
+    if ( workerCount <= 0 ) {
+        workerCount = std::max( static_cast<int>( std::thread::hardware_concurrency() ) - 1, 1 );
+    }
+
+    // Every deque is made before any worker starts stealing from them.
+    for ( int i = 0; i < workerCount; i++ ) {
+        m_workers.push_back( std::unique_ptr<Worker>( new Worker() ) );
+    }
+
+    int cpuCount = std::max( static_cast<int>( std::thread::hardware_concurrency() ), 1 );
+    for ( int i = 0; i < workerCount; i++ ) {
+        m_workers[i]->thread = std::thread( &ThreadPool::RunWorker, this, i );
+        if ( isPinningThreads ) { PinThread( m_workers[i]->thread, i % cpuCount ); }
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_sleepMutex );
+        m_isStopping = true;
+    }
+    m_wakeCondition.notify_all();
+
+    for ( auto &worker : m_workers ) {
+        worker->thread.join();
+    }
+}
+
+ThreadPool& ThreadPool::GetInstance()
+{
+    std::lock_guard<std::mutex> lock( s_instanceMutex );
+    if ( !s_instance ) { s_instance.reset( new ThreadPool( s_instanceWorkerCount, s_isInstancePinningThreads ) ); }
+    return *s_instance;
+}
+
+bool ThreadPool::ConfigureInstance( int workerCount, bool isPinningThreads )
+{
+    std::lock_guard<std::mutex> lock( s_instanceMutex );
+    if ( s_instance ) { return false; }
+    s_instanceWorkerCount = workerCount;
+    s_isInstancePinningThreads = isPinningThreads;
+    return true;
+}
+
+void ThreadPool::Submit( Task task )
+{
+    int workerIndex = GetCurrentWorkerIndex();
+    if ( workerIndex < 0 ) {
+        workerIndex = static_cast<int>( m_nextWorker++ % m_workers.size() );
+    }
+
+    Worker &worker = *m_workers[workerIndex];
+    {
+        std::lock_guard<std::mutex> lock( worker.mutex );
+        worker.tasks.push_back( std::move( task ) );
+    }
+
+    // Counted and signalled under the sleep lock, so a worker can't check for work and then miss the wake up.
+    {
+        std::lock_guard<std::mutex> lock( m_sleepMutex );
+        m_queuedTaskCount++;
+    }
+    m_wakeCondition.notify_one();
+}
+
+bool ThreadPool::RunPendingTask()
+{
+    int workerIndex = GetCurrentWorkerIndex();
+    int workerCount = static_cast<int>( m_workers.size() );
+
+    Task task;
+    bool isFound = false;
+    if ( workerIndex >= 0 ) {
+        Worker &worker = *m_workers[workerIndex];
+        std::lock_guard<std::mutex> lock( worker.mutex );
+        if ( !worker.tasks.empty() ) {
+            task = std::move( worker.tasks.back() );
+            worker.tasks.pop_back();
+            isFound = true;
+        }
+    }
+
+    // Steal, starting after our own deque so the thieves spread out.
+    for ( int i = 1; i <= workerCount && !isFound; i++ ) {
+        Worker &victim = *m_workers[( std::max( workerIndex, 0 ) + i ) % workerCount];
+        std::lock_guard<std::mutex> lock( victim.mutex );
+        if ( !victim.tasks.empty() ) {
+            task = std::move( victim.tasks.front() );
+            victim.tasks.pop_front();
+            isFound = true;
+        }
+    }
+
+    if ( !isFound ) { return false; }
+
+    m_queuedTaskCount--;
+    if ( !task.group->IsCancelled() ) { task.function(); }
+    task.group->m_pendingCount--;
+    return true;
+}
+
+void ThreadPool::RunWorker( int workerIndex )
+{
+    t_workerPool = this;
+    t_workerIndex = workerIndex;
+
+    while ( true ) {
+        if ( RunPendingTask() ) { continue; }
+
+        std::unique_lock<std::mutex> lock( m_sleepMutex );
+        m_wakeCondition.wait( lock, [this]() { return m_isStopping || m_queuedTaskCount > 0; } );
+        if ( m_isStopping && m_queuedTaskCount == 0 ) { return; }
+    }
+}
+
+int ThreadPool::GetCurrentWorkerIndex() const
+{
+    return t_workerPool == this ? t_workerIndex : -1;
+}
+
+void TaskGroup::Run( std::function<void()> function )
+{
+    m_pendingCount++;
+    m_pool.Submit( ThreadPool::Task{ std::move( function ), this } );
+}
+
+void TaskGroup::Wait()
+{
+    while ( m_pendingCount > 0 ) {
+        // The group's last tasks may be running elsewhere with nothing left to help with.
+        if ( !m_pool.RunPendingTask() ) { std::this_thread::yield(); }
+    }
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace checkers {
+
+class TaskGroup;
+
+/**
+ * A fixed set of worker threads that run tasks, shared by everything in the engine that works in parallel so
+ * they don't each start their own threads and oversubscribe the machine.
+ *
+ * Each worker has its own deque. Tasks submitted from a worker go on the back of its deque and it takes them from
+ * the back, so nested work stays on one core while it's hot in the cache. A worker with nothing to do steals from
+ * the front of another worker's deque, where the oldest and usually biggest tasks are. Tasks submitted from
+ * outside the pool are dealt out to the workers in turn. Idle workers sleep until there's work.
+ *
+ * Tasks are submitted through a TaskGroup, which is how they're waited on and cancelled.
+ */
+class ThreadPool
+{
+public:
+    /// workerCount 0 means one fewer than the hardware threads, as the thread waiting on a group runs tasks too.
+    /// When pinning, worker i only runs on CPU i, on Windows and Linux. Elsewhere pinning is ignored.
+    explicit ThreadPool( int workerCount = 0, bool isPinningThreads = false );
+
+    /// Runs the tasks still queued, then stops the workers.
+    ~ThreadPool();
+
+    /// The engine-wide pool, made on first use.
+    static ThreadPool& GetInstance();
+
+    /// Sets the worker count and pinning of the engine-wide pool. Returns false if it's already been made.
+    static bool ConfigureInstance( int workerCount, bool isPinningThreads );
+
+    int GetWorkerCount() const { return static_cast<int>( m_workers.size() ); }
+
+private:
+    friend class TaskGroup;
+
+    struct Task
+    {
+        std::function<void()> function;
+        TaskGroup *group;
+    };
+
+    /// A worker's deque is locked while it's pushed or popped, never while a task runs.
+    struct Worker
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+        std::thread thread;
+    };
+
+    void Submit( Task task );
+
+    /// Runs one queued task, the calling worker's own newest first and then the oldest of another's.
+    /// Returns false if every deque was empty.
+    bool RunPendingTask();
+
+    void RunWorker( int workerIndex );
+
+    /// The index of the calling thread's worker in this pool, -1 for threads outside it.
+    int GetCurrentWorkerIndex() const;
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::atomic<int> m_queuedTaskCount;
+    std::atomic<unsigned> m_nextWorker;
+
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wakeCondition;
+    bool m_isStopping;
+};
+
+/**
+ * Tasks that are waited on and cancelled together. Groups can be nested: a task can run a group of its own and
+ * wait on it, and while any thread waits it runs queued tasks instead of blocking, so nesting can't starve the pool.
+ *
+ * Cancelling skips the group's tasks that haven't started. Running tasks carry on unless they check IsCancelled,
+ * or are handed the cancel flag to watch.
+ */
+class TaskGroup
+{
+public:
+    explicit TaskGroup( ThreadPool &pool = ThreadPool::GetInstance() ) :
+        m_pool( pool ),
+        m_pendingCount( 0 ),
+        m_isCancelled( false )
+    {}
+
+    /// Waits for the group's tasks.
+    ~TaskGroup() { Wait(); }
+
+    TaskGroup( const TaskGroup& ) = delete;
+    TaskGroup& operator=( const TaskGroup& ) = delete;
+
+    void Run( std::function<void()> function );
+
+    /// Returns once every task in the group has run or been skipped, running queued tasks meanwhile.
+    void Wait();
+
+    void Cancel() { m_isCancelled = true; }
+    bool IsCancelled() const { return m_isCancelled.load( std::memory_order_relaxed ); }
+
+    /// Set once the group is cancelled, for long running tasks to stop on.
+    const std::atomic<bool>* GetCancelFlag() const { return &m_isCancelled; }
+
+private:
+    friend class ThreadPool;
+
+    ThreadPool &m_pool;
+    std::atomic<int> m_pendingCount;
+    std::atomic<bool> m_isCancelled;
+};
+
+}
@@ -0,0 +1,48 @@
+#include "TimeManager.h"
+
+#include <algorithm>
+
+using namespace checkers;
+
+const double TimeManager::MoveOverheadSeconds = 0.02;
+const double TimeManager::MaximumFactor = 4;
+
+TimeManager::TimeManager( const CheckersBoard &board, const Clock &clock ) :
+    m_stableIterationCount( 0 ),
+    m_hasBestMove( false )
+{
+    double availableSeconds = std::max( clock.remainingSeconds - MoveOverheadSeconds, 0.0 );
+    int movesToGo = clock.movesToGo > 0 ? clock.movesToGo : EstimateMovesToGo( board );
+
+    // Most of the increment can be spent as it comes, it's back on the clock after the move.
+    m_optimumSeconds = std::min( availableSeconds / movesToGo + clock.incrementSeconds * 0.75, availableSeconds );
+
+    // Never more than half the clock, unless it's the last move before a top up.
+    double maximumSeconds = std::min( m_optimumSeconds * MaximumFactor, availableSeconds * 0.5 );
+    m_maximumSeconds = std::min( std::max( maximumSeconds, m_optimumSeconds ), availableSeconds );
+}
+
+bool TimeManager::ShouldStartIteration( double elapsedSeconds, const MovePath &bestMove )
+{
+    double stabilityFactor;
+    if ( m_hasBestMove && bestMove == m_bestMove ) {
+        m_stableIterationCount++;
+        stabilityFactor = std::max( 1.0 - 0.1 * m_stableIterationCount, 0.5 );
+    }
+    else {
+        m_stableIterationCount = 0;
+        stabilityFactor = m_hasBestMove ? 1.5 : 1.0;
+    }
+    m_bestMove = bestMove;
+    m_hasBestMove = true;
+
+    double allowedSeconds = std::min( m_optimumSeconds * stabilityFactor, m_maximumSeconds );
+    return elapsedSeconds < allowedSeconds * 0.5;
+}
+
+int TimeManager::EstimateMovesToGo( const CheckersBoard &board )
+{
+    // About 36 moves from the start position, falling to about 14 with a couple of pieces each.
+    Bitboard pieces = board.GetPieces( CheckersBoard::SideType::White ) | board.GetPieces( CheckersBoard::SideType::Black );
+    return 12 + PopCount( pieces );
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CheckersBoard.h"
+#include "MovePath.h"
+
+namespace checkers {
+
+/**
+ * Decides how long to think about a move when playing on a clock.
+ *
+ * The remaining time is shared over the moves still to play, which when the clock doesn't say is estimated from
+ * the pieces left: a full board has a long game ahead of it, a bare endgame a short one. That gives the optimum
+ * time for the move, and the maximum is a few times that, so a move that needs more thought can have it without
+ * risking the clock.
+ *
+ * Between iterations the search asks whether to start another. An iteration takes longer than all the ones before
+ * it, so one is only started in the first half of the time allowed. The allowance grows when the best move has
+ * just changed, as the search hasn't settled, and shrinks the longer the best move stays the same.
+ */
+class TimeManager
+{
+public:
+    struct Clock
+    {
+        Clock() : remainingSeconds( 0 ), incrementSeconds( 0 ), movesToGo( 0 ) {}
+
+        double remainingSeconds;
+
+        /// Added to the clock after each move.
+        double incrementSeconds;
+
+        /// Moves until the clock is topped up, 0 if it never is.
+        int movesToGo;
+    };
+
+    /// Time kept back from every move for the time it takes to send it.
+    static const double MoveOverheadSeconds;
+
+    /// The maximum time for a move as a multiple of the optimum.
+    static const double MaximumFactor;
+
+    TimeManager( const CheckersBoard &board, const Clock &clock );
+
+    double GetOptimumSeconds() const { return m_optimumSeconds; }
+    double GetMaximumSeconds() const { return m_maximumSeconds; }
+
+    /// Called after each completed iteration with its best move. Returns whether there's time for another.
+    bool ShouldStartIteration( double elapsedSeconds, const MovePath &bestMove );
+
+    /// The number of moves the side to move is likely to have left to play.
+    static int EstimateMovesToGo( const CheckersBoard &board );
+
+private:
+    double m_optimumSeconds;
+    double m_maximumSeconds;
+
+    MovePath m_bestMove;
+    int m_stableIterationCount;
+    bool m_hasBestMove;
+};
+
+}
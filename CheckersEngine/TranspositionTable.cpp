@@ -0,0 +1,144 @@
+#include "TranspositionTable.h"
+
+#include <algorithm>
+#include <new>
+
+using namespace checkers;
+
+const int TranspositionTable::EntriesPerBucket;
+const int TranspositionTable::MaxDepth;
+const int TranspositionTable::NumberOfGenerations;
+
+TranspositionTable::TranspositionTable( int sizeMB ) :
+    m_buckets( nullptr ),
+    m_bucketCount( 0 ),
+    m_generation( 0 ),
+    m_probes( 0 ),
+    m_hits( 0 ),
+    m_stores( 0 ),
+    m_collisions( 0 )
+{
+    Resize( sizeMB );
+}
+
+void TranspositionTable::Resize( int sizeMB )
+{
+    size_t sizeBytes = static_cast<size_t>( std::max( sizeMB, 0 ) ) * 1024 * 1024;
+    m_bucketCount = 1;
+    while ( m_bucketCount * 2 * sizeof( Bucket ) <= sizeBytes ) {
+        m_bucketCount *= 2;
+    }
+
+    // Line the buckets up with the cache lines, new[] only aligns to the largest fundamental type.
+    m_memory.reset( new uint8_t[m_bucketCount * sizeof( Bucket ) + sizeof( Bucket )] );
+    uintptr_t address = reinterpret_cast<uintptr_t>( m_memory.get() );
+    m_buckets = reinterpret_cast<Bucket*>( ( address + sizeof( Bucket ) - 1 ) & ~static_cast<uintptr_t>( sizeof( Bucket ) - 1 ) );
+    // Placement new[] may want room for a cookie the slack doesn't leave, so construct the buckets one by one.
+    for ( size_t i = 0; i < m_bucketCount; i++ ) {
+        new ( &m_buckets[i] ) Bucket;
+    }
+
+    Clear();
+}
+
+void TranspositionTable::Clear()
+{
+    for ( size_t i = 0; i < m_bucketCount; i++ ) {
+        for ( auto &entry : m_buckets[i].entries ) {
+            entry.keyXorData.store( 0, std::memory_order_relaxed );
+            entry.data.store( 0, std::memory_order_relaxed );
+        }
+    }
+    m_probes = 0;
+    m_hits = 0;
+    m_stores = 0;
+    m_collisions = 0;
+    m_generation = 0;
+}
+
+bool TranspositionTable::Probe( uint64_t key, ProbeResult &result )
+{
+    Statistics statistics;
+    bool found = Probe( key, result, statistics );
+    AddStatistics( statistics );
+    return found;
+}
+
+bool TranspositionTable::Probe( uint64_t key, ProbeResult &result, Statistics &statistics ) const
+{
+    statistics.probes++;
+    Bucket &bucket = GetBucket( key );
+    for ( auto &entry : bucket.entries ) {
+        Data data{ entry.data.load( std::memory_order_relaxed ) };
+        uint64_t keyXorData = entry.keyXorData.load( std::memory_order_relaxed );
+        if ( ( keyXorData ^ data.data ) == key && data.data != 0 ) {
+            statistics.hits++;
+            result.score = data.GetScore();
+            result.depth = data.GetDepth();
+            result.bound = data.GetBound();
+            result.moveIndex = data.GetMoveIndex();
+            return true;
+        }
+    }
+    return false;
+}
+
+void TranspositionTable::Store( uint64_t key, int depth, Bound bound, int score, int moveIndex )
+{
+    Statistics statistics;
+    Store( key, depth, bound, score, moveIndex, statistics );
+    AddStatistics( statistics );
+}
+
+void TranspositionTable::Store( uint64_t key, int depth, Bound bound, int score, int moveIndex, Statistics &statistics )
+{
+    statistics.stores++;
+    depth = std::min( std::max( depth, 0 ), MaxDepth );
+    Bucket &bucket = GetBucket( key );
+
+    // Overwrite the position's own entry if it has one, otherwise an empty entry or the one least worth keeping.
+    // Another thread may be storing into the bucket too, at worst one of the two stores is lost.
+    Entry *replace = &bucket.entries[0];
+    Data replaceData{ replace->data.load( std::memory_order_relaxed ) };
+    uint64_t replaceKey = replace->keyXorData.load( std::memory_order_relaxed ) ^ replaceData.data;
+    for ( auto &entry : bucket.entries ) {
+        Data data{ entry.data.load( std::memory_order_relaxed ) };
+        uint64_t entryKey = entry.keyXorData.load( std::memory_order_relaxed ) ^ data.data;
+        if ( entryKey == key || data.data == 0 ) {
+            replace = &entry;
+            replaceData = data;
+            replaceKey = entryKey;
+            break;
+        }
+        if ( GetWorth( data ) < GetWorth( replaceData ) ) {
+            replace = &entry;
+            replaceData = data;
+            replaceKey = entryKey;
+        }
+    }
+
+    if ( replaceData.data != 0 && replaceKey != key ) {
+        statistics.collisions++;
+    }
+    Data data = Data::Pack( score, depth, bound, moveIndex, m_generation );
+    replace->keyXorData.store( key ^ data.data, std::memory_order_relaxed );
+    replace->data.store( data.data, std::memory_order_relaxed );
+}
+
+void TranspositionTable::AddStatistics( const Statistics &statistics )
+{
+    m_probes.fetch_add( statistics.probes, std::memory_order_relaxed );
+    m_hits.fetch_add( statistics.hits, std::memory_order_relaxed );
+    m_stores.fetch_add( statistics.stores, std::memory_order_relaxed );
+    m_collisions.fetch_add( statistics.collisions, std::memory_order_relaxed );
+}
+
+TranspositionTable::Statistics TranspositionTable::GetStatistics() const
+{
+    Statistics statistics;
+    statistics.probes = m_probes.load( std::memory_order_relaxed );
+    statistics.hits = m_hits.load( std::memory_order_relaxed );
+    statistics.stores = m_stores.load( std::memory_order_relaxed );
+    statistics.collisions = m_collisions.load( std::memory_order_relaxed );
+    return statistics;
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace checkers {
+
+/**
+ * Remembers search results by position, so a position reached by different move orders is only searched once.
+ * Keyed by the board's Zobrist hash. The table is a power of two number of 64 byte buckets, one cache line each,
+ * holding four 16 byte entries: the full key and the result packed into a second word.
+ *
+ * Entries are aged by a generation that moves on with each search. When a bucket is full the store replaces the
+ * entry that's least worth keeping, the shallowest one with older searches counting as shallower.
+ *
+ * Any number of threads can probe and store at once without locks. Each entry holds the key XORed with the data,
+ * and a probe only matches when XORing the two words it read gives back the key. A read that sees half of one store
+ * and half of another, or a store racing another store, fails the check and is a miss.
+ * Threads count their own statistics with the Statistics overloads and add them to the table when they finish,
+ * so they don't contend on shared counters. Resize, Clear and NewSearch must not race the searches.
+ */
+class TranspositionTable
+{
+public:
+    /// How the stored score relates to the true score of the position.
+    enum class Bound { None, Exact, Lower, Upper };
+
+    /// What a probe found.
+    struct ProbeResult
+    {
+        int score;
+        int depth;
+        Bound bound;
+
+        /// The index of the best move in GetMovePaths order.
+        int moveIndex;
+    };
+
+    /// Counts of the table's use since it was created or cleared.
+    struct Statistics
+    {
+        Statistics() : probes( 0 ), hits( 0 ), stores( 0 ), collisions( 0 ) {}
+
+        uint64_t probes;
+        uint64_t hits;
+        uint64_t stores;
+
+        /// Stores that replaced an entry for a different position.
+        uint64_t collisions;
+    };
+
+    static const int EntriesPerBucket = 4;
+
+    /// The deepest depth an entry can hold.
+    static const int MaxDepth = 255;
+
+    /// The number of searches before a generation comes around again.
+    static const int NumberOfGenerations = 64;
+
+    /// Creates a table of up to sizeMB megabytes, rounded down to a power of two buckets. At least one bucket.
+    explicit TranspositionTable( int sizeMB );
+
+    /// Reallocates the table, which forgets every entry.
+    void Resize( int sizeMB );
+
+    /// Forgets every entry and resets the statistics.
+    void Clear();
+
+    /// Starts a new search, entries from earlier searches are replaced first.
+    void NewSearch() { m_generation = ( m_generation + 1 ) % NumberOfGenerations; }
+
+    /// Looks up a position. Returns false if it isn't in the table.
+    bool Probe( uint64_t key, ProbeResult &result );
+
+    /// Looks up a position, counting into the caller's statistics.
+    bool Probe( uint64_t key, ProbeResult &result, Statistics &statistics ) const;
+
+    /// Stores the result of searching a position. depth is clamped to 0 to MaxDepth.
+    void Store( uint64_t key, int depth, Bound bound, int score, int moveIndex );
+
+    /// Stores the result of searching a position, counting into the caller's statistics.
+    void Store( uint64_t key, int depth, Bound bound, int score, int moveIndex, Statistics &statistics );
+
+    size_t GetBucketCount() const { return m_bucketCount; }
+    size_t GetSizeBytes() const { return m_bucketCount * sizeof( Bucket ); }
+
+    /// Adds counts made with the Statistics overloads to the table's totals.
+    void AddStatistics( const Statistics &statistics );
+
+    Statistics GetStatistics() const;
+
+private:
+    /**
+     * The result is packed into one word: score in bits 0-15, depth in 16-23, move index in 24-31,
+     * bound in 32-33 and generation in 34-39. An empty entry is all zeros, a stored entry always has a bound.
+     */
+    struct Data
+    {
+        uint64_t data;
+
+        int GetScore() const { return static_cast<int16_t>( data & 0xFFFF ); }
+        int GetDepth() const { return static_cast<int>( ( data >> 16 ) & 0xFF ); }
+        int GetMoveIndex() const { return static_cast<int>( ( data >> 24 ) & 0xFF ); }
+        Bound GetBound() const { return static_cast<Bound>( ( data >> 32 ) & 3 ); }
+        int GetGeneration() const { return static_cast<int>( ( data >> 34 ) & 0x3F ); }
+
+        static Data Pack( int score, int depth, Bound bound, int moveIndex, int generation )
+        {
+            return Data{ static_cast<uint64_t>( static_cast<uint16_t>( score ) ) | ( static_cast<uint64_t>( depth ) << 16 ) |
+                         ( static_cast<uint64_t>( moveIndex & 0xFF ) << 24 ) | ( static_cast<uint64_t>( bound ) << 32 ) |
+                         ( static_cast<uint64_t>( generation ) << 34 ) };
+        }
+    };
+
+    /// Both words are read and written separately with relaxed atomics, the XOR check catches the mixed ones.
+    struct Entry
+    {
+        std::atomic<uint64_t> keyXorData;
+        std::atomic<uint64_t> data;
+    };
+
+    struct Bucket
+    {
+        Entry entries[EntriesPerBucket];
+    };
+
+    static_assert( sizeof( Entry ) == 16, "Entries are packed into 16 bytes" );
+    static_assert( sizeof( Bucket ) == 64, "A bucket is one cache line" );
+
+    Bucket& GetBucket( uint64_t key ) const { return m_buckets[key & ( m_bucketCount - 1 )]; }
+
+    /// How much an entry is worth keeping, deeper and newer entries are worth more.
+    int GetWorth( Data data ) const
+    {
+        int age = ( m_generation - data.GetGeneration() + NumberOfGenerations ) % NumberOfGenerations;
+        return data.GetDepth() - age * 8;
+    }
+
+    std::unique_ptr<uint8_t[]> m_memory;
+    Bucket *m_buckets;
+    size_t m_bucketCount;
+    int m_generation;
+
+    std::atomic<uint64_t> m_probes;
+    std::atomic<uint64_t> m_hits;
+    std::atomic<uint64_t> m_stores;
+    std::atomic<uint64_t> m_collisions;
+};
+
+}
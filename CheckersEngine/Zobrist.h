@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Bitboard.h"
+#include "SquareTables.h"
+
+#include <assert.h>
+#include <cstdint>
+
+namespace checkers {
+
+/**
+ * Random keys for Zobrist hashing of a board position.
+ * There's a key for each kind of piece (white or black, man or king) on each square, plus a key for black to move.
+ * A position's hash is the XOR of the keys of its pieces, so moves update it with a few XORs.
+ * The keys come from SplitMix64 evaluated by the compiler.
+ * There are keys for up to 64 squares, so every board geometry shares the same table.
+ */
+namespace Zobrist {
+
+    const int NumberOfPieceKinds = 4;
+    const int MaxSquares = 64;
+    const int SideKeyIndex = NumberOfPieceKinds * MaxSquares;
+    const int NumberOfKeys = SideKeyIndex + 1;
+
+    // SplitMix64, split into single expressions for C++11 constexpr.
+    constexpr uint64_t Mix3( uint64_t z ) { return z ^ ( z >> 31 ); }
+    constexpr uint64_t Mix2( uint64_t z ) { return Mix3( ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBull ); }
+    constexpr uint64_t Mix1( uint64_t z ) { return Mix2( ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ull ); }
+    constexpr uint64_t GetKey( int index ) { return Mix1( 0x2545F4914F6CDD1Dull + 0x9E3779B97F4A7C15ull * ( index + 1 ) ); }
+
+    template<typename Sequence> struct Tables;
+
+    template<int... Indices>
+    struct Tables< SquareGeometry::IndexSequence<Indices...> >
+    {
+        static constexpr uint64_t Keys[sizeof...( Indices )] = { GetKey( Indices )... };
+    };
+
+    template<int... Indices> constexpr uint64_t Tables< SquareGeometry::IndexSequence<Indices...> >::Keys[sizeof...( Indices )];
+
+    typedef Tables< SquareGeometry::MakeIndexSequence<NumberOfKeys>::Type > KeyTables;
+
+    /// The key for a piece on a square.
+    inline uint64_t GetPieceKey( bool isWhite, bool isKing, int square )
+    {
+        assert( square >= 0 && square < MaxSquares );
+        return KeyTables::Keys[( ( isWhite ? 0 : 2 ) + ( isKing ? 1 : 0 ) ) * MaxSquares + square];
+    }
+
+    /// The key XORed in when black is to move.
+    inline uint64_t GetSideKey()
+    {
+        return KeyTables::Keys[SideKeyIndex];
+    }
+
+    /// XOR of the keys for every piece of one kind on the board.
+    template<typename BitboardType>
+    inline uint64_t GetPiecesKey( bool isWhite, bool isKing, BitboardType pieces )
+    {
+        uint64_t key = 0;
+        while ( pieces != 0 ) {
+            key ^= GetPieceKey( isWhite, isKing, PopLowestSquare( pieces ) );
+        }
+        return key;
+    }
+}
+
+}
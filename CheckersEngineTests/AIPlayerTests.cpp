@@ -12,8 +12,8 @@ TEST( ai_player, test_get_only_move )
 {
 	CheckersBoard board(EmptyPieceLayout, CheckersBoard::SideType::White);
 
-	Pos p1{ 0, 0 };
-	Pos p2{ 1, 1 };
+	Pos p1{ 0, 7 };
+	Pos p2{ 1, 6 };
 
 	board.SetPiece(p1, Piece::PieceType::White);
 
@@ -27,9 +27,9 @@ TEST(ai_player, test_get_jump_move)
 {
 	CheckersBoard board(EmptyPieceLayout, CheckersBoard::SideType::White);
 
-	Pos p1{ 0, 0 };
-	Pos p2{ 1, 1 }; // p1 can jump p2
-	Pos p3{ 4, 0 };
+	Pos p1{ 0, 7 };
+	Pos p2{ 1, 6 }; // p1 can jump p2
+	Pos p3{ 4, 7 };
 
 	board.SetPiece(p1, Piece::PieceType::White);
 	board.SetPiece(p2, Piece::PieceType::Black);
@@ -38,6 +38,6 @@ TEST(ai_player, test_get_jump_move)
 	AIPlayer aiPlayer;
 	Move move = aiPlayer.ChooseBestMove(board);
 
-	Pos endPos{ 2, 2 };
+	Pos endPos{ 2, 5 };
 	EXPECT_EQ( move.to, endPos );
 }
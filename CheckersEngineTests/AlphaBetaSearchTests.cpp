@@ -0,0 +1,153 @@
+#include "AIPlayer.h"
+#include "AlphaBetaSearch.h"
+#include "CheckersBoard.h"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+#include "gtest/gtest.h"
+
+using namespace checkers;
+using PieceType = checkers::Piece::PieceType;
+
+static const PieceType EmptyPieceLayout[CheckersBoard::NumberOfSquares] {};
+
+// The same scoring as the search, without any pruning.
+static int Minimax( const CheckersBoard &board, int depth, int ply )
+{
+    MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    if ( movePaths.empty() ) { return -( AlphaBetaSearch::WinScore - ply ); }
+    if ( ( depth <= 0 && !movePaths[0].IsCapture() ) || ply >= AlphaBetaSearch::MaxPly ) { return AlphaBetaSearch::Evaluate( board ); }
+
+    int bestScore = -AlphaBetaSearch::Infinity;
+    for ( auto &movePath : movePaths ) {
+        CheckersBoard childBoard = board;
+        childBoard.DoMoveUnchecked( movePath );
+        bestScore = std::max( bestScore, -Minimax( childBoard, depth - 1, ply + 1 ) );
+    }
+    return bestScore;
+}
+
+
+TEST( alpha_beta_search_test, test_matches_minimax )
+{
+    std::mt19937 rng( 7 );
+    for ( int game = 0; game < 10; game++ ) {
+        CheckersBoard board;
+        for ( int ply = 0; ply < 40 && !board.IsFinished(); ply++ ) {
+            if ( ply % 8 == 7 ) {
+                AlphaBetaSearch search;
+                ASSERT_EQ( Minimax( board, 4, 0 ), search.Search( board, 4 ).score );
+            }
+
+            MovePathList movePaths;
+            board.GetMovePaths( movePaths );
+            board.DoMove( movePaths[rng() % movePaths.size()] );
+        }
+    }
+}
+
+TEST( alpha_beta_search_test, test_scores_quickest_win )
+{
+    // White can take the last black piece straight away, or wait.
+    CheckersBoard board( EmptyPieceLayout, CheckersBoard::SideType::White );
+    board.SetPiece( { 2, 1 }, Piece( PieceType::White, true ) );
+    board.SetPiece( { 3, 2 }, PieceType::Black );
+
+    AlphaBetaSearch search;
+    auto result = search.Search( board, 6 );
+    EXPECT_EQ( AlphaBetaSearch::WinScore - 1, result.score );
+    EXPECT_EQ( 1, result.depth );
+    EXPECT_EQ( PosToSquare( { 4, 3 } ), result.bestMove.GetTo() );
+
+    // The side that has lost scores the loss at once.
+    board.DoMove( result.bestMove );
+    EXPECT_EQ( -AlphaBetaSearch::WinScore, search.Search( board, 6 ).score );
+}
+
+TEST( alpha_beta_search_test, test_searches_default_board )
+{
+    CheckersBoard board;
+    AlphaBetaSearch search;
+    auto result = search.Search( board, 6 );
+    EXPECT_EQ( 6, result.depth );
+    EXPECT_FALSE( AlphaBetaSearch::IsWinScore( result.score ) );
+    EXPECT_TRUE( board.CanMove( result.bestMove.GetFirstHop() ) );
+    EXPECT_GT( result.nodes, 0u );
+}
+
+TEST( alpha_beta_search_test, test_ai_player_search_mode )
+{
+    AIPlayer aiPlayer;
+    EXPECT_EQ( AIPlayer::SearchMode::GameTree, aiPlayer.GetSearchMode() );
+    aiPlayer.SetSearchMode( AIPlayer::SearchMode::AlphaBeta );
+    aiPlayer.SetSearchDepth( 6 );
+
+    CheckersBoard board;
+    EXPECT_TRUE( board.CanMove( aiPlayer.ChooseBestMove( board ) ) );
+
+    // Takes the piece that would otherwise take one of its own.
+    CheckersBoard jumpBoard( EmptyPieceLayout, CheckersBoard::SideType::White );
+    jumpBoard.SetPiece( { 0, 7 }, PieceType::White );
+    jumpBoard.SetPiece( { 1, 6 }, PieceType::Black );
+    jumpBoard.SetPiece( { 4, 7 }, PieceType::White );
+    Pos endPos{ 2, 5 };
+    EXPECT_EQ( endPos, aiPlayer.ChooseBestMove( jumpBoard ).to );
+}
+
+TEST( alpha_beta_search_test, test_node_limit )
+{
+    CheckersBoard board;
+    AlphaBetaSearch::Limits limits;
+    limits.maxNodes = 20000;
+
+    AlphaBetaSearch search;
+    auto result = search.Search( board, limits );
+    EXPECT_LE( result.nodes, limits.maxNodes );
+    EXPECT_GT( result.depth, 0 );
+    EXPECT_LT( result.depth, AlphaBetaSearch::MaxPly );
+
+    // The unfinished iteration is thrown away, the result is the last one completed.
+    auto depthResult = search.Search( board, result.depth );
+    EXPECT_EQ( depthResult.score, result.score );
+    EXPECT_EQ( depthResult.bestMove, result.bestMove );
+}
+
+TEST( alpha_beta_search_test, test_time_limit )
+{
+    CheckersBoard board;
+    AlphaBetaSearch::Limits limits;
+    limits.maxSeconds = 0.05;
+
+    auto startTime = std::chrono::steady_clock::now();
+    AlphaBetaSearch search;
+    auto result = search.Search( board, limits );
+    double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - startTime ).count();
+    EXPECT_LT( seconds, 0.5 );
+    EXPECT_GT( result.depth, 0 );
+    EXPECT_TRUE( board.CanMove( result.bestMove.GetFirstHop() ) );
+}
+
+TEST( alpha_beta_search_test, test_ai_player_limits )
+{
+    CheckersBoard board;
+    AIPlayer aiPlayer;
+    aiPlayer.SetSearchMode( AIPlayer::SearchMode::AlphaBeta );
+    aiPlayer.SetSearchDepth( AlphaBetaSearch::MaxPly );
+    aiPlayer.SetNodeLimit( 10000 );
+    EXPECT_EQ( 10000u, aiPlayer.GetNodeLimit() );
+    EXPECT_TRUE( board.CanMove( aiPlayer.ChooseBestMove( board ) ) );
+
+    aiPlayer.SetNodeLimit( 0 );
+    aiPlayer.SetMoveTime( 0.05 );
+    EXPECT_DOUBLE_EQ( 0.05, aiPlayer.GetMoveTime() );
+    EXPECT_TRUE( board.CanMove( aiPlayer.ChooseBestMove( board ) ) );
+
+    // On a clock, with a second left for the game.
+    aiPlayer.SetMoveTime( 0 );
+    auto startTime = std::chrono::steady_clock::now();
+    EXPECT_TRUE( board.CanMove( aiPlayer.ChooseBestMove( board, 1.0 ) ) );
+    EXPECT_LT( std::chrono::duration<double>( std::chrono::steady_clock::now() - startTime ).count(), 0.5 );
+}
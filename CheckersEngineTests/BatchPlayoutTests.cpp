@@ -0,0 +1,98 @@
+#include "BatchPlayout.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace checkers;
+
+// Returns whether the board can be reached from the previous board with a single hop.
+static bool IsReachable( const CheckersBoard &previous, const CheckersBoard &board )
+{
+    MoveList moves;
+    previous.GetMoves( moves );
+    for ( auto move : moves ) {
+        CheckersBoard childBoard = previous;
+        childBoard.DoMoveUnchecked( move );
+        if ( childBoard == board ) { return true; }
+    }
+    return false;
+}
+
+
+// Steps the boards on a kernel and checks every hop against the board's own move generator.
+static void CheckStepsAreLegal( BatchPlayout::Kernel kernel )
+{
+    const int boardCount = 37;
+    BatchPlayout playout( boardCount, 1234, kernel );
+
+    for ( int step = 0; step < 200; step++ ) {
+        std::vector<CheckersBoard> previousBoards;
+        for ( int i = 0; i < boardCount; i++ ) {
+            previousBoards.push_back( playout.GetBoard( i ) );
+        }
+
+        playout.Step( 1000 );
+
+        for ( int i = 0; i < boardCount; i++ ) {
+            CheckersBoard board = playout.GetBoard( i );
+            if ( board == previousBoards[i] ) {
+                ASSERT_TRUE( playout.IsFinished( i ) );
+                ASSERT_TRUE( board.IsFinished() );
+                EXPECT_EQ( board.GetWinner(), playout.GetWinner( i ) );
+            }
+            else {
+                ASSERT_TRUE( IsReachable( previousBoards[i], board ) ) << "board " << i << " step " << step;
+            }
+        }
+    }
+}
+
+TEST( batch_playout_test, test_steps_are_legal )
+{
+    CheckStepsAreLegal( BatchPlayout::Kernel::Simd );
+}
+
+TEST( batch_playout_test, test_scalar_steps_are_legal )
+{
+    CheckStepsAreLegal( BatchPlayout::Kernel::Scalar );
+}
+
+TEST( batch_playout_test, test_kernels_match )
+{
+    const int boardCount = 29;
+    BatchPlayout simdPlayout( boardCount, 77, BatchPlayout::Kernel::Simd );
+    BatchPlayout scalarPlayout( boardCount, 77, BatchPlayout::Kernel::Scalar );
+    EXPECT_EQ( BatchPlayout::Kernel::Scalar, scalarPlayout.GetKernel() );
+
+    for ( int step = 0; step < 300; step++ ) {
+        ASSERT_EQ( simdPlayout.Step( 200 ), scalarPlayout.Step( 200 ) );
+        for ( int i = 0; i < boardCount; i++ ) {
+            ASSERT_EQ( simdPlayout.GetBoard( i ), scalarPlayout.GetBoard( i ) ) << "board " << i << " step " << step;
+        }
+    }
+    EXPECT_EQ( simdPlayout.GetTotalPlies(), scalarPlayout.GetTotalPlies() );
+}
+
+TEST( batch_playout_test, test_run_finishes_every_board )
+{
+    const int boardCount = 64;
+    BatchPlayout playout( boardCount, 99 );
+    playout.Run( 150 );
+
+    uint64_t plies = 0;
+    for ( int i = 0; i < boardCount; i++ ) {
+        EXPECT_TRUE( playout.IsFinished( i ) );
+        EXPECT_LE( playout.GetPlies( i ), 150 );
+        if ( playout.GetWinner( i ) != CheckersBoard::WinType::Draw ) {
+            EXPECT_TRUE( playout.GetBoard( i ).IsFinished() );
+        }
+        plies += playout.GetPlies( i );
+    }
+    EXPECT_EQ( plies, playout.GetTotalPlies() );
+
+    // Setting a board restarts its game
+    playout.SetBoard( 3, CheckersBoard() );
+    EXPECT_FALSE( playout.IsFinished( 3 ) );
+    EXPECT_EQ( CheckersBoard(), playout.GetBoard( 3 ) );
+}
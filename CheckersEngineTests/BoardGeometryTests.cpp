@@ -0,0 +1,94 @@
+#include "CheckersBoard.h"
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace checkers;
+
+// Shifting a single square lands on the same square as the tables, for every square and direction.
+template<typename Geometry>
+static void CheckShiftsMatchTables()
+{
+    for ( int square = 0; square < Geometry::NumberOfPlayableSquares; square++ ) {
+        for ( int i = 0; i < NumberOfDirections; i++ ) {
+            Direction direction = static_cast<Direction>( i );
+            EXPECT_EQ( SquareTables<Geometry>::GetNeighbourMask( square, direction ),
+                       Geometry::Shift( Geometry::GetSquareMask( square ), direction ) ) << "square " << square << " direction " << i;
+        }
+    }
+}
+
+// Counts the positions depth moves from the board.
+template<typename Board>
+static uint64_t CountPositions( const Board &board, int depth )
+{
+    if ( depth == 0 ) { return 1; }
+    typename Board::MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    uint64_t count = 0;
+    for ( auto &movePath : movePaths ) {
+        Board childBoard = board;
+        childBoard.DoMoveUnchecked( movePath );
+        count += CountPositions( childBoard, depth - 1 );
+    }
+    return count;
+}
+
+
+TEST( board_geometry_test, test_shifts_match_tables )
+{
+    CheckShiftsMatchTables<Geometry8x8>();
+    CheckShiftsMatchTables<Geometry10x10>();
+}
+
+TEST( board_geometry_test, test_pos_round_trip )
+{
+    for ( int square = 0; square < Geometry10x10::NumberOfPlayableSquares; square++ ) {
+        Pos pos = Geometry10x10::SquareToPos( square );
+        EXPECT_EQ( 1, ( pos.row + pos.column ) % 2 );
+        EXPECT_EQ( square, Geometry10x10::PosToSquare( pos ) );
+    }
+}
+
+TEST( board_geometry_test, test_draughts_default_board )
+{
+    DraughtsBoard board;
+    EXPECT_EQ( 20, board.GetPieceCount( DraughtsBoard::SideType::White ) );
+    EXPECT_EQ( 20, board.GetPieceCount( DraughtsBoard::SideType::Black ) );
+    EXPECT_EQ( Piece::PieceType::White, board.GetPiece( { 3, 0 } ).pieceType );
+    EXPECT_EQ( Piece::PieceType::None, board.GetPiece( { 4, 1 } ).pieceType );
+    EXPECT_EQ( Piece::PieceType::Black, board.GetPiece( { 6, 1 } ).pieceType );
+    EXPECT_EQ( board.GetHash(), board.ComputeHash() );
+
+    EXPECT_EQ( 9u, CountPositions( board, 1 ) );
+    EXPECT_EQ( 81u, CountPositions( board, 2 ) );
+}
+
+TEST( board_geometry_test, test_draughts_random_games )
+{
+    std::mt19937 rng( 5 );
+    for ( int game = 0; game < 20; game++ ) {
+        DraughtsBoard board;
+        std::vector<DraughtsBoard::UndoRecord> undoRecords;
+
+        for ( int ply = 0; ply < 300 && !board.IsFinished(); ply++ ) {
+            DraughtsBoard::MovePathList movePaths;
+            board.GetMovePaths( movePaths );
+            ASSERT_FALSE( movePaths.empty() );
+
+            auto movePath = movePaths[rng() % movePaths.size()];
+            EXPECT_TRUE( board.CanMove( movePath.GetFirstHop() ) );
+            undoRecords.push_back( DraughtsBoard::UndoRecord() );
+            board.DoMove( movePath, undoRecords.back() );
+            ASSERT_EQ( board.GetHash(), board.ComputeHash() );
+        }
+
+        while ( !undoRecords.empty() ) {
+            board.UndoMove( undoRecords.back() );
+            undoRecords.pop_back();
+        }
+        EXPECT_EQ( DraughtsBoard(), board );
+    }
+}
@@ -1,5 +1,9 @@
 #include "CheckersBoard.h"
 
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+
 #include "gtest/gtest.h"
 
 using namespace checkers;
@@ -7,6 +11,30 @@ using PieceType = checkers::Piece::PieceType;
 
 static const PieceType EmptyPieceLayout[CheckersBoard::NumberOfSquares] {};
 
+// Collect every move that passes CanMove by trying all pairs of squares.
+static std::vector<Move> GetCheckedMoves( const CheckersBoard &board )
+{
+    std::vector<Move> moves;
+    for ( int from = 0; from < CheckersBoard::NumberOfSquares; from++ ) {
+        for ( int to = 0; to < CheckersBoard::NumberOfSquares; to++ ) {
+            Move move{ { from / CheckersBoard::NumberOfColumns, from % CheckersBoard::NumberOfColumns },
+                       { to / CheckersBoard::NumberOfColumns, to % CheckersBoard::NumberOfColumns } };
+            if ( board.CanMove( move ) ) { moves.push_back( move ); }
+        }
+    }
+    return moves;
+}
+
+// Returns true if both move lists hold the same moves, in any order.
+static bool IsSameMoves( const MoveList &moves1, const std::vector<Move> &moves2 )
+{
+    if ( moves1.size() != static_cast<int>( moves2.size() ) ) { return false; }
+    for ( auto move : moves1 ) {
+        if ( std::find( moves2.begin(), moves2.end(), move ) == moves2.end() ) { return false; }
+    }
+    return true;
+}
+
 
 class EmptyBoardTest : public ::testing::Test
 {
@@ -38,6 +66,22 @@ TEST_F( DefaultBoardTest, test_is_occupied )
 }
 
 
+TEST_F( DefaultBoardTest, test_is_playable )
+{
+    EXPECT_TRUE( board.IsPlayable( {0, 1} ) );
+    EXPECT_FALSE( board.IsPlayable( {0, 0} ) ); // Light squares never hold a piece
+    EXPECT_FALSE( board.IsPlayable( {-1, 0} ) );
+
+    // Every dark square is playable
+    int playableCount = 0;
+    for ( int row = 0; row < CheckersBoard::NumberOfRows; row++ ) {
+        for ( int column = 0; column < CheckersBoard::NumberOfColumns; column++ ) {
+            if ( board.IsPlayable( {row, column} ) ) { playableCount++; }
+        }
+    }
+    EXPECT_EQ( NumberOfPlayableSquares, playableCount );
+}
+
 TEST_F( DefaultBoardTest, test_is_out_of_bounds )
 {
     EXPECT_TRUE( board.IsOutOfBounds( {0, -1} ) );
@@ -66,9 +110,9 @@ TEST_F( DefaultBoardTest, test_move )
 
 TEST_F(EmptyBoardTest, test_jump_removes_piece)
 {
-	Pos startPos{ 0, 0 };
-	Pos p1{ 1, 1 };
-	Pos endPos{ 2, 2 };
+	Pos startPos{ 0, 7 };
+	Pos p1{ 1, 6 };
+	Pos endPos{ 2, 5 };
 
 	board.SetPiece(startPos, PieceType::White);
 	board.SetPiece(p1, PieceType::Black);
@@ -102,17 +146,17 @@ TEST_F( EmptyBoardTest, test_cant_move_no_piece )
 
 TEST_F( EmptyBoardTest, test_can_move_error_jump )
 {
-    board.SetPiece( {0, 0}, PieceType::White );
-    board.SetPiece( {1, 1}, PieceType::Black );
-    EXPECT_EQ( board.GetMoveError( { {0, 0}, {2, 2} } ), CheckersBoard::MoveError::None );
+    board.SetPiece( {0, 7}, PieceType::White );
+    board.SetPiece( {1, 6}, PieceType::Black );
+    EXPECT_EQ( board.GetMoveError( { {0, 7}, {2, 5} } ), CheckersBoard::MoveError::None );
 
-    board.RemovePiece( {1, 1} );
-    EXPECT_EQ( board.GetMoveError( { {0, 0}, {2, 2} } ), CheckersBoard::MoveError::NoJumpPiece );
+    board.RemovePiece( {1, 6} );
+    EXPECT_EQ( board.GetMoveError( { {0, 7}, {2, 5} } ), CheckersBoard::MoveError::NoJumpPiece );
 }
 
 TEST_F( DefaultBoardTest, test_can_move_error_jump_default_board )
 {
-    std::vector<Move> jumpMoves;
+    MoveList jumpMoves;
     board.GetJumpMoves( jumpMoves );
     EXPECT_EQ( 0, jumpMoves.size() );
 
@@ -121,8 +165,8 @@ TEST_F( DefaultBoardTest, test_can_move_error_jump_default_board )
 
 TEST_F( EmptyBoardTest, test_cant_move_wrong_side )
 {
-    Pos p1{ 0, 0 };
-    Pos p2{ 1, 1 };
+    Pos p1{ 0, 7 };
+    Pos p2{ 1, 6 };
 
     board.SetPiece( p1, PieceType::White );
     Move move{ p1, p2 };
@@ -144,7 +188,7 @@ TEST_F( EmptyBoardTest, test_cant_move_wrong_side )
 
 TEST_F( EmptyBoardTest, test_cant_move_backward )
 {
-    Pos startPos{ 1, 1 };
+    Pos startPos{ 1, 6 };
     board.SetPiece( startPos, PieceType::White );
 
     Move moveForward{ startPos, startPos + Pos{ 1, 1 } };
@@ -156,52 +200,52 @@ TEST_F( EmptyBoardTest, test_cant_move_backward )
 
 TEST_F( EmptyBoardTest, test_jumps_available )
 {
-    std::vector<Move> jumpMoves;
+    MoveList jumpMoves;
 
     // No jump moves available
     board.GetJumpMoves( jumpMoves );
     EXPECT_EQ( 0, jumpMoves.size() );
 
-    board.SetPiece( { 0, 0 }, PieceType::White );
+    board.SetPiece( { 0, 7 }, PieceType::White );
     board.GetJumpMoves( jumpMoves );
     EXPECT_EQ( 0, jumpMoves.size() );
 
-    board.SetPiece( { 1, 1 }, PieceType::Black );
+    board.SetPiece( { 1, 6 }, PieceType::Black );
     board.GetJumpMoves( jumpMoves );
     EXPECT_EQ( 1, jumpMoves.size() );
     jumpMoves.clear();
 
-    board.SetPiece( { 2, 2 }, PieceType::Black );
+    board.SetPiece( { 2, 5 }, PieceType::Black );
     board.GetJumpMoves( jumpMoves );
     EXPECT_EQ( 0, jumpMoves.size() );
 }
 
 TEST_F( EmptyBoardTest, test_cant_move_if_jump_available )
 {
-    Pos startPos{ 0, 0 };
+    Pos startPos{ 0, 7 };
     board.SetPiece( startPos, PieceType::White );
 
-    Pos jumpPos{ 1, 1 };
+    Pos jumpPos{ 1, 6 };
     board.SetPiece( jumpPos, PieceType::Black );
 
     // Jump move is OK
-    Move jumpMove{ startPos, startPos + Pos{ 2, 2 } };
+    Move jumpMove{ startPos, startPos + Pos{ 2, -2 } };
     EXPECT_EQ( board.GetMoveError( jumpMove ), CheckersBoard::MoveError::None );
 
-    Pos otherPos{ 4, 4 };
+    Pos otherPos{ 4, 3 };
     board.SetPiece( otherPos, PieceType::White );
 
-    Move otherMove{ { 4, 4 }, { 5, 5 } };
+    Move otherMove{ { 4, 3 }, { 5, 2 } };
     EXPECT_EQ( board.GetMoveError( otherMove ), CheckersBoard::MoveError::MustJump );
 }
 
 TEST_F( EmptyBoardTest, test_multi_jump )
 {
-    Pos p1{ 0, 0 };
-    Pos jumpPos1{ 1, 1 };
-    Pos p2{ 2, 2 };
-    Pos jumpPos2{ 3, 3 };
-    Pos p3{ 4, 4 };
+    Pos p1{ 0, 7 };
+    Pos jumpPos1{ 1, 6 };
+    Pos p2{ 2, 5 };
+    Pos jumpPos2{ 3, 4 };
+    Pos p3{ 4, 3 };
 
     // Set up a double jump
     board.SetPiece( p1, PieceType::White );
@@ -219,8 +263,8 @@ TEST_F( EmptyBoardTest, test_multi_jump )
 
 TEST_F( EmptyBoardTest, test_make_a_king )
 {
-    Pos p1{ CheckersBoard::NumberOfRows-2, 0 };
-    Pos p2{ CheckersBoard::NumberOfRows-1, 1 };
+    Pos p1{ CheckersBoard::NumberOfRows-2, CheckersBoard::NumberOfColumns-1 };
+    Pos p2{ CheckersBoard::NumberOfRows-1, CheckersBoard::NumberOfColumns-2 };
 
     board.SetPiece(p1, PieceType::White);
     EXPECT_FALSE( board.GetPiece(p1).isKing );
@@ -230,7 +274,7 @@ TEST_F( EmptyBoardTest, test_make_a_king )
 
 TEST_F( EmptyBoardTest, test_king_moving_backwards )
 {
-	Move backwardsMove{ Pos{ 1, 1 }, Pos{ 0, 0 } };
+	Move backwardsMove{ Pos{ 1, 6 }, Pos{ 0, 7 } };
 
 	// Place a plain piece
 	board.SetPiece(backwardsMove.from, Piece(PieceType::White, false));
@@ -243,7 +287,7 @@ TEST_F( EmptyBoardTest, test_king_moving_backwards )
 
 TEST_F( EmptyBoardTest, test_king_jump )
 {
-	Move backwardsJump{ Pos{ 2, 2 }, Pos{ 0, 0 } };
+	Move backwardsJump{ Pos{ 2, 5 }, Pos{ 0, 7 } };
 
 	board.SetPiece(backwardsJump.from, Piece(PieceType::White, false)); // Plain piece
 	board.SetPiece(backwardsJump.GetJumpPos(), PieceType::Black);
@@ -261,11 +305,11 @@ TEST_F(EmptyBoardTest, test_win)
 {
 	EXPECT_TRUE(board.IsFinished());
 
-	board.SetPiece(Pos{ 0, 0 }, PieceType::Black);
-	board.SetPiece(Pos{ 1, 1 }, PieceType::White);
+	board.SetPiece(Pos{ 0, 7 }, PieceType::Black);
+	board.SetPiece(Pos{ 1, 6 }, PieceType::White);
 
 	EXPECT_FALSE(board.IsFinished());
-	board.RemovePiece(Pos{ 1, 1 });
+	board.RemovePiece(Pos{ 1, 6 });
 
 	EXPECT_TRUE(board.IsFinished()); // No white pieces, Black is the winner.
 	EXPECT_EQ(board.GetWinner(), CheckersBoard::WinType::Black);
@@ -273,17 +317,36 @@ TEST_F(EmptyBoardTest, test_win)
 
 TEST_F(DefaultBoardTest, test_get_moves_default)
 {
-	std::vector<Move> moves;
+	MoveList moves;
 	board.GetMoves(moves);
 	EXPECT_FALSE(moves.empty());
 }
 
+TEST_F(DefaultBoardTest, test_get_moves_matches_can_move)
+{
+	MoveList moves;
+	board.GetMoves(moves);
+	EXPECT_EQ(7, moves.size());
+	EXPECT_TRUE(IsSameMoves(moves, GetCheckedMoves(board)));
+
+	// Play a few moves into a position with jumps and kings for both sides
+	board.DoMove(Move{ { 2, 3 }, { 3, 4 } });
+	board.DoMove(Move{ { 5, 6 }, { 4, 5 } });
+	board.SetPiece({ 4, 1 }, Piece(PieceType::White, true));
+	board.SetPiece({ 3, 2 }, Piece(PieceType::Black, true));
+
+	moves.clear();
+	board.GetMoves(moves);
+	EXPECT_FALSE(moves.empty());
+	EXPECT_TRUE(IsSameMoves(moves, GetCheckedMoves(board)));
+}
+
 TEST_F(EmptyBoardTest, test_get_moves_one)
 {
-	Pos p1{ 0, 0 };
+	Pos p1{ 0, 7 };
 	board.SetPiece(p1, PieceType::White);
 
-	std::vector<Move> moves;
+	MoveList moves;
 	board.GetMoves(moves);
 
 	EXPECT_EQ(1, moves.size());
@@ -294,17 +357,17 @@ TEST_F(EmptyBoardTest, test_get_moves_two)
 {
 	CheckersBoard board(EmptyPieceLayout, CheckersBoard::SideType::White);
 
-	Pos p1{ 0, 0 };
-	Pos p2{ 0, 2 };
-	Pos p3{ 1, 1 }; // p1 and p2 can jump p2
-	Pos p4{ 4, 0 }; // Can't move, jumps happen first
+	Pos p1{ 0, 7 };
+	Pos p2{ 0, 5 };
+	Pos p3{ 1, 6 }; // p1 and p2 can jump p3
+	Pos p4{ 4, 7 }; // Can't move, jumps happen first
 
 	board.SetPiece(p1, Piece::PieceType::White);
 	board.SetPiece(p2, Piece::PieceType::White);
 	board.SetPiece(p3, Piece::PieceType::Black);
 	board.SetPiece(p4, Piece::PieceType::White);
 
-	std::vector<Move> moves;
+	MoveList moves;
 	board.GetMoves(moves);
 
 	EXPECT_EQ(2, moves.size());
@@ -314,10 +377,290 @@ TEST_F(EmptyBoardTest, test_get_moves_two)
 
 TEST_F(DefaultBoardTest, test_copy_constructor)
 {
-	board.SetPiece({ 0, 0 }, PieceType::White);
 	CheckersBoard board1(board);
-	board1.DoMove(Move{ { 0, 0 }, { 1, 1 } });
+	board1.DoMove(Move{ { 2, 1 }, { 3, 0 } });
+
+	EXPECT_NE(board.GetPiece({ 3, 0 }).pieceType, PieceType::White);
+	EXPECT_EQ(board1.GetPiece({ 3, 0 }).pieceType, PieceType::White);
+}
 
-	EXPECT_NE(board.GetPiece({ 1, 1 }).pieceType, PieceType::White);
-	EXPECT_EQ(board1.GetPiece({ 1, 1 }).pieceType, PieceType::White);
+TEST_F(EmptyBoardTest, test_set_king_piece)
+{
+	Pos p1{ 3, 4 };
+
+	board.SetPiece(p1, Piece(PieceType::Black, true));
+	EXPECT_EQ(board.GetPiece(p1), Piece(PieceType::Black, true));
+
+	// Replacing a king with a plain piece clears the king
+	board.SetPiece(p1, PieceType::White);
+	EXPECT_EQ(board.GetPiece(p1), Piece(PieceType::White, false));
+
+	board.RemovePiece(p1);
+	EXPECT_EQ(board.GetPiece(p1).pieceType, PieceType::None);
+	EXPECT_FALSE(board.IsOccupied(p1));
+}
+
+TEST_F( EmptyBoardTest, test_move_path_multi_jump )
+{
+    Pos p1{ 0, 7 };
+    Pos jumpPos1{ 1, 6 };
+    Pos jumpPos2{ 3, 4 };
+    Pos p3{ 4, 3 };
+
+    board.SetPiece( p1, PieceType::White );
+    board.SetPiece( jumpPos1, PieceType::Black );
+    board.SetPiece( jumpPos2, PieceType::Black );
+    board.SetPiece( { 7, 0 }, PieceType::Black );
+
+    // The double jump is a single move
+    MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    ASSERT_EQ( 1, movePaths.size() );
+    MovePath movePath = movePaths[0];
+    EXPECT_EQ( 2, movePath.GetHopCount() );
+    EXPECT_EQ( movePath.GetHop( 1 ).to, p3 );
+
+    // Playing the hops one at a time gives the same board
+    CheckersBoard hopBoard( board );
+    for ( int i = 0; i < movePath.GetHopCount(); i++ ) {
+        hopBoard.DoMove( movePath.GetHop( i ) );
+    }
+
+    board.DoMove( movePath );
+    EXPECT_EQ( board, hopBoard );
+    EXPECT_EQ( board.GetPiece( p3 ).pieceType, PieceType::White );
+    EXPECT_FALSE( board.IsOccupied( jumpPos1 ) );
+    EXPECT_FALSE( board.IsOccupied( jumpPos2 ) );
+    EXPECT_EQ( board.GetCurrentSide(), CheckersBoard::SideType::Black );
+}
+
+TEST_F( EmptyBoardTest, test_move_path_crowning_ends_move )
+{
+    Pos p1{ 5, 2 };
+    Pos jumpPos1{ 6, 3 };
+    Pos p2{ 7, 4 };
+    Pos jumpPos2{ 6, 5 }; // Could only be jumped by a king
+
+    board.SetPiece( p1, PieceType::White );
+    board.SetPiece( jumpPos1, PieceType::Black );
+    board.SetPiece( jumpPos2, PieceType::Black );
+
+    MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    ASSERT_EQ( 1, movePaths.size() );
+    EXPECT_EQ( 1, movePaths[0].GetHopCount() );
+
+    CheckersBoard hopBoard( board );
+    hopBoard.DoMove( Move{ p1, p2 } );
+
+    board.DoMove( movePaths[0] );
+    EXPECT_EQ( board, hopBoard );
+    EXPECT_EQ( board.GetPiece( p2 ), Piece( PieceType::White, true ) );
+    EXPECT_TRUE( board.IsOccupied( jumpPos2 ) );
+    EXPECT_EQ( board.GetCurrentSide(), CheckersBoard::SideType::Black );
+}
+
+TEST_F( DefaultBoardTest, test_move_path_not_allowed )
+{
+    MovePath movePath{};
+    movePath.AddSquare( PosToSquare( { 2, 1 } ) );
+    movePath.AddSquare( PosToSquare( { 4, 3 } ) );
+    EXPECT_THROW( board.DoMove( movePath ), std::out_of_range );
+}
+
+TEST_F( EmptyBoardTest, test_undo_move_capture_and_crown )
+{
+    Pos p1{ 5, 2 };
+    Pos jumpPos{ 6, 3 };
+
+    board.SetPiece( p1, PieceType::White );
+    board.SetPiece( jumpPos, Piece( PieceType::Black, true ) );
+    CheckersBoard startBoard( board );
+
+    MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    ASSERT_EQ( 1, movePaths.size() );
+
+    CheckersBoard::UndoRecord undoRecord;
+    board.DoMove( movePaths[0], undoRecord );
+    EXPECT_EQ( board.GetPiece( { 7, 4 } ), Piece( PieceType::White, true ) );
+    EXPECT_FALSE( board.IsOccupied( jumpPos ) );
+
+    board.UndoMove( undoRecord );
+    EXPECT_EQ( board, startBoard );
+    EXPECT_EQ( board.GetPiece( jumpPos ), Piece( PieceType::Black, true ) ); // The captured king is back
+}
+
+TEST_F( DefaultBoardTest, test_undo_move_game )
+{
+    std::mt19937 rng( 1234 );
+    std::vector<CheckersBoard> boards;
+    std::vector<CheckersBoard::UndoRecord> undoRecords;
+
+    // Play a game of random moves in place
+    for ( int ply = 0; ply < 200; ply++ ) {
+        MovePathList movePaths;
+        board.GetMovePaths( movePaths );
+        if ( movePaths.empty() ) { break; }
+
+        boards.push_back( board );
+        undoRecords.push_back( CheckersBoard::UndoRecord() );
+        board.DoMove( movePaths[rng() % movePaths.size()], undoRecords.back() );
+    }
+    EXPECT_LT( 10u, undoRecords.size() );
+
+    // Taking back every move visits the same boards in reverse
+    while ( !undoRecords.empty() ) {
+        board.UndoMove( undoRecords.back() );
+        EXPECT_EQ( board, boards.back() );
+        undoRecords.pop_back();
+        boards.pop_back();
+    }
+    EXPECT_EQ( board, CheckersBoard() );
+}
+
+TEST_F( DefaultBoardTest, test_do_move_unchecked )
+{
+    std::mt19937 rng( 4321 );
+    CheckersBoard checkedBoard( board );
+
+    // Generated moves give the same boards with and without checking
+    for ( int ply = 0; ply < 200; ply++ ) {
+        MoveList moves;
+        board.GetMoves( moves );
+        if ( moves.empty() ) { break; }
+
+        Move move = moves[rng() % moves.size()];
+        checkedBoard.DoMove( move );
+        board.DoMoveUnchecked( move );
+        ASSERT_EQ( board, checkedBoard );
+    }
+}
+
+TEST_F( DefaultBoardTest, test_piece_counts )
+{
+    EXPECT_EQ( 12, board.GetPieceCount( CheckersBoard::SideType::White ) );
+    EXPECT_EQ( 12, board.GetPieceCount( CheckersBoard::SideType::Black ) );
+    EXPECT_EQ( 0, board.GetKingCount( CheckersBoard::SideType::White ) );
+
+    board.SetPiece( { 3, 0 }, Piece( PieceType::White, true ) );
+    board.RemovePiece( { 5, 0 } );
+    EXPECT_EQ( 13, board.GetPieceCount( CheckersBoard::SideType::White ) );
+    EXPECT_EQ( 1, board.GetKingCount( CheckersBoard::SideType::White ) );
+    EXPECT_EQ( 11, board.GetPieceCount( CheckersBoard::SideType::Black ) );
+}
+
+TEST_F( EmptyBoardTest, test_win_when_blocked )
+{
+    // Black's only man is on white's king row and can't move
+    board.SetPiece( { 0, 7 }, PieceType::Black );
+    board.SetPiece( { 3, 0 }, PieceType::White );
+    EXPECT_TRUE( board.HasMoves() );
+    EXPECT_FALSE( board.IsFinished() );
+
+    board.DoMove( Move{ { 3, 0 }, { 4, 1 } } );
+    EXPECT_FALSE( board.HasMoves() );
+    EXPECT_TRUE( board.IsFinished() );
+    EXPECT_EQ( board.GetWinner(), CheckersBoard::WinType::White );
+}
+
+TEST_F( DefaultBoardTest, test_hash_transposition )
+{
+    CheckersBoard board1( board );
+    EXPECT_EQ( board.GetHash(), board.ComputeHash() );
+
+    // The same position reached by two move orders has the same hash
+    board.DoMove( Move{ { 2, 1 }, { 3, 0 } } );
+    board.DoMove( Move{ { 5, 0 }, { 4, 1 } } );
+    board.DoMove( Move{ { 2, 3 }, { 3, 4 } } );
+
+    board1.DoMove( Move{ { 2, 3 }, { 3, 4 } } );
+    board1.DoMove( Move{ { 5, 0 }, { 4, 1 } } );
+    EXPECT_NE( board.GetHash(), board1.GetHash() ); // Different side to move
+    board1.DoMove( Move{ { 2, 1 }, { 3, 0 } } );
+
+    EXPECT_EQ( board, board1 );
+    EXPECT_EQ( board.GetHash(), board1.GetHash() );
+    EXPECT_NE( board.GetHash(), CheckersBoard().GetHash() );
+}
+
+TEST_F( DefaultBoardTest, test_hash_incremental )
+{
+    std::mt19937 rng( 99 );
+    std::vector<CheckersBoard::UndoRecord> undoRecords;
+
+    for ( int ply = 0; ply < 200; ply++ ) {
+        MovePathList movePaths;
+        board.GetMovePaths( movePaths );
+        if ( movePaths.empty() ) { break; }
+
+        undoRecords.push_back( CheckersBoard::UndoRecord() );
+        board.DoMove( movePaths[rng() % movePaths.size()], undoRecords.back() );
+        ASSERT_EQ( board.GetHash(), board.ComputeHash() );
+    }
+
+    while ( !undoRecords.empty() ) {
+        board.UndoMove( undoRecords.back() );
+        undoRecords.pop_back();
+        ASSERT_EQ( board.GetHash(), board.ComputeHash() );
+    }
+
+    board.SetPiece( { 3, 0 }, Piece( PieceType::Black, true ) );
+    board.RemovePiece( { 0, 1 } );
+    EXPECT_EQ( board.GetHash(), board.ComputeHash() );
+}
+
+TEST_F( EmptyBoardTest, test_forced_jump_follows_changes )
+{
+    board.SetPiece( { 2, 1 }, PieceType::White );
+    board.SetPiece( { 2, 5 }, PieceType::White );
+
+    Move stepMove{ { 2, 5 }, { 3, 4 } };
+    EXPECT_TRUE( board.CanMove( stepMove ) );
+
+    // Adding a piece to jump forces the jump
+    board.SetPiece( { 3, 2 }, PieceType::Black );
+    EXPECT_EQ( board.GetMoveError( stepMove ), CheckersBoard::MoveError::MustJump );
+
+    MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    ASSERT_EQ( 1, movePaths.size() );
+    EXPECT_THROW( board.DoMove( stepMove ), std::out_of_range );
+
+    // The jump can be taken back, restoring the forced jump
+    CheckersBoard::UndoRecord undoRecord;
+    board.DoMove( movePaths[0], undoRecord );
+    EXPECT_EQ( CheckersBoard::SideType::Black, board.GetCurrentSide() );
+    board.UndoMove( undoRecord );
+    EXPECT_EQ( board.GetMoveError( stepMove ), CheckersBoard::MoveError::MustJump );
+
+    // Removing it allows the step again
+    board.RemovePiece( { 3, 2 } );
+    EXPECT_TRUE( board.CanMove( stepMove ) );
+}
+
+TEST( move_list_test, test_grows_past_capacity )
+{
+    // Moves past the inline capacity move to the heap rather than being dropped.
+    FixedMoveList<PackedMove, 4> moves;
+    for ( int i = 0; i < 11; i++ ) {
+        moves.push_back( PackedMove( i, i + 4, Direction::UpRight, false ) );
+    }
+    ASSERT_EQ( 11, moves.size() );
+    EXPECT_TRUE( moves.IsOnHeap() );
+    for ( int i = 0; i < moves.size(); i++ ) {
+        EXPECT_EQ( i, moves[i].GetFrom() );
+    }
+
+    // Copies get their own moves.
+    FixedMoveList<PackedMove, 4> copy = moves;
+    moves.clear();
+    ASSERT_EQ( 11, copy.size() );
+    EXPECT_EQ( 10, copy.back().GetFrom() );
+
+    FixedMoveList<PackedMove, 4> small;
+    small.push_back( copy[0] );
+    copy = small;
+    ASSERT_EQ( 1, copy.size() );
+    EXPECT_EQ( 0, copy[0].GetFrom() );
 }
@@ -0,0 +1,105 @@
+#include "CheckersGame.h"
+
+#include "gtest/gtest.h"
+
+using namespace checkers;
+using PieceType = checkers::Piece::PieceType;
+
+static const PieceType EmptyPieceLayout[CheckersBoard::NumberOfSquares] {};
+
+// Finds the generated move between two positions.
+static MovePath FindMove( const CheckersBoard &board, const Pos &from, const Pos &to )
+{
+    MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    for ( auto movePath : movePaths ) {
+        if ( movePath.GetFrom() == PosToSquare( from ) && movePath.GetTo() == PosToSquare( to ) ) { return movePath; }
+    }
+    ADD_FAILURE() << "Move not found";
+    return MovePath();
+}
+
+
+class KingsGameTest : public ::testing::Test
+{
+public:
+    KingsGameTest() :
+        game( MakeBoard() )
+    {}
+
+    // A white and a black king that can shuffle back and forth.
+    static CheckersBoard MakeBoard()
+    {
+        CheckersBoard board( EmptyPieceLayout, CheckersBoard::SideType::White );
+        board.SetPiece( { 0, 1 }, Piece( PieceType::White, true ) );
+        board.SetPiece( { 7, 6 }, Piece( PieceType::Black, true ) );
+        return board;
+    }
+
+    // Both kings step out and back, returning to the start position.
+    void ShuffleKings()
+    {
+        game.DoMove( FindMove( game.GetBoard(), { 0, 1 }, { 1, 2 } ) );
+        game.DoMove( FindMove( game.GetBoard(), { 7, 6 }, { 6, 5 } ) );
+        game.DoMove( FindMove( game.GetBoard(), { 1, 2 }, { 0, 1 } ) );
+        game.DoMove( FindMove( game.GetBoard(), { 6, 5 }, { 7, 6 } ) );
+    }
+
+    CheckersGame game;
+};
+
+
+TEST_F( KingsGameTest, test_threefold_repetition )
+{
+    EXPECT_EQ( 1, game.GetRepetitionCount() );
+    EXPECT_FALSE( game.IsRepetition() );
+
+    ShuffleKings();
+    EXPECT_EQ( 2, game.GetRepetitionCount() );
+    EXPECT_TRUE( game.IsRepetition() );
+    EXPECT_FALSE( game.IsDraw() );
+
+    ShuffleKings();
+    EXPECT_EQ( 3, game.GetRepetitionCount() );
+    EXPECT_TRUE( game.IsDraw() );
+    EXPECT_TRUE( game.IsFinished() );
+    EXPECT_EQ( game.GetWinner(), CheckersBoard::WinType::Draw );
+
+    // Taking back a move removes the draw
+    game.UndoMove();
+    EXPECT_FALSE( game.IsDraw() );
+    EXPECT_EQ( 7, game.GetPly() );
+}
+
+TEST_F( KingsGameTest, test_forty_move_rule )
+{
+    // Cycles of 4 and 14 squares that keep the kings apart, the position only repeats every 28 moves
+    Pos whiteSquares[] = { { 0, 1 }, { 1, 2 }, { 2, 1 }, { 1, 0 } };
+    Pos blackSquares[] = { { 7, 6 }, { 6, 7 }, { 5, 6 }, { 4, 5 }, { 5, 4 }, { 4, 3 }, { 5, 2 },
+                           { 4, 1 }, { 5, 0 }, { 6, 1 }, { 7, 2 }, { 6, 3 }, { 7, 4 }, { 6, 5 } };
+    int move = 0;
+    while ( game.GetReversiblePlies() < CheckersGame::DrawPlies ) {
+        EXPECT_FALSE( game.IsFinished() );
+        EXPECT_LT( game.GetRepetitionCount(), CheckersGame::DrawRepetitions );
+
+        game.DoMove( FindMove( game.GetBoard(), whiteSquares[move % 4], whiteSquares[( move + 1 ) % 4] ) );
+        game.DoMove( FindMove( game.GetBoard(), blackSquares[move % 14], blackSquares[( move + 1 ) % 14] ) );
+        move++;
+    }
+
+    EXPECT_EQ( CheckersGame::DrawPlies, game.GetReversiblePlies() );
+    EXPECT_TRUE( game.IsDraw() );
+}
+
+TEST( checkers_game, test_man_move_is_irreversible )
+{
+    CheckersGame game;
+    EXPECT_EQ( 0, game.GetReversiblePlies() );
+
+    game.DoMove( FindMove( game.GetBoard(), { 2, 1 }, { 3, 0 } ) );
+    EXPECT_EQ( 0, game.GetReversiblePlies() );
+    EXPECT_EQ( 1, game.GetPly() );
+
+    game.UndoMove();
+    EXPECT_EQ( game.GetBoard(), CheckersBoard() );
+}
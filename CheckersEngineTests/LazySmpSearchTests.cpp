@@ -0,0 +1,95 @@
+#include "AIPlayer.h"
+#include "AlphaBetaSearch.h"
+#include "CheckersBoard.h"
+#include "LazySmpSearch.h"
+#include "TranspositionTable.h"
+
+#include <atomic>
+#include <random>
+
+#include "gtest/gtest.h"
+
+using namespace checkers;
+
+
+TEST( lazy_smp_search_test, test_deterministic_matches_single_thread )
+{
+    std::mt19937 rng( 11 );
+    for ( int game = 0; game < 4; game++ ) {
+        CheckersBoard board;
+        for ( int ply = 0; ply < 30 && !board.IsFinished(); ply++ ) {
+            if ( ply % 10 == 9 ) {
+                AlphaBetaSearch search;
+                auto result = search.Search( board, 7 );
+
+                for ( int threadCount = 1; threadCount <= 4; threadCount *= 2 ) {
+                    TranspositionTable table( 1 );
+                    LazySmpSearch parallelSearch( &table, threadCount );
+                    parallelSearch.SetDeterministic( true );
+                    auto parallelResult = parallelSearch.Search( board, 7 );
+                    EXPECT_EQ( result.score, parallelResult.score );
+                    EXPECT_EQ( result.bestMove, parallelResult.bestMove );
+                    EXPECT_EQ( 7, parallelResult.depth );
+                }
+            }
+
+            MovePathList movePaths;
+            board.GetMovePaths( movePaths );
+            board.DoMove( movePaths[rng() % movePaths.size()] );
+        }
+    }
+}
+
+TEST( lazy_smp_search_test, test_searches_on_threads )
+{
+    CheckersBoard board;
+    TranspositionTable table( 4 );
+    LazySmpSearch search( &table, 4 );
+    auto result = search.Search( board, 9 );
+    EXPECT_EQ( 9, result.depth );
+    EXPECT_FALSE( AlphaBetaSearch::IsWinScore( result.score ) );
+    EXPECT_TRUE( board.CanMove( result.bestMove.GetFirstHop() ) );
+    EXPECT_GT( table.GetStatistics().hits, 0u );
+
+    // Without a table there's nothing to share, so it's a single thread search.
+    LazySmpSearch tablelessSearch( nullptr, 4 );
+    AlphaBetaSearch singleSearch;
+    EXPECT_EQ( singleSearch.Search( board, 6 ).nodes, tablelessSearch.Search( board, 6 ).nodes );
+}
+
+TEST( lazy_smp_search_test, test_stop_flag )
+{
+    CheckersBoard board;
+    std::atomic<bool> stop( true );
+    AlphaBetaSearch search;
+    search.SetStopFlag( &stop );
+
+    // Stopped before an iteration is done, it still has a legal move.
+    auto result = search.Search( board, 8 );
+    EXPECT_EQ( 0, result.depth );
+    EXPECT_TRUE( board.CanMove( result.bestMove.GetFirstHop() ) );
+
+    stop = false;
+    EXPECT_EQ( 8, search.Search( board, 8 ).depth );
+}
+
+TEST( lazy_smp_search_test, test_ai_player_threads )
+{
+    CheckersBoard board;
+    AIPlayer singlePlayer;
+    singlePlayer.SetSearchMode( AIPlayer::SearchMode::AlphaBeta );
+    singlePlayer.SetSearchDepth( 7 );
+    singlePlayer.SetDeterministic( true );
+
+    AIPlayer parallelPlayer;
+    parallelPlayer.SetSearchMode( AIPlayer::SearchMode::AlphaBeta );
+    parallelPlayer.SetSearchDepth( 7 );
+    parallelPlayer.SetThreadCount( 4 );
+    EXPECT_EQ( 4, parallelPlayer.GetThreadCount() );
+    parallelPlayer.SetDeterministic( true );
+    EXPECT_TRUE( parallelPlayer.IsDeterministic() );
+
+    for ( int i = 0; i < 3; i++ ) {
+        EXPECT_EQ( singlePlayer.ChooseBestMove( board ), parallelPlayer.ChooseBestMove( board ) );
+    }
+}
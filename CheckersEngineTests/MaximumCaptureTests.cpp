@@ -0,0 +1,233 @@
+#include "CheckersBoard.h"
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace checkers;
+
+// Sets up a board with only the given pieces, white to move.
+template<typename Board>
+static Board MakeBoard( const std::vector<std::pair<Pos, Piece>> &pieces )
+{
+    Piece::PieceType pieceTypes[Board::NumberOfSquares] = {};
+    Board board( pieceTypes, Board::SideType::White );
+    for ( auto &piece : pieces ) {
+        board.SetPiece( piece.first, piece.second );
+    }
+    return board;
+}
+
+typedef MaximumCaptureDraughtsBoard::MovePath MaximumCapturePath;
+
+// Extends path by every capture a square at a time, with the international draughts rules: taken pieces stay on the
+// board until the move is over, men capture both ways and pass the king row as men, kings fly.
+static void AddAllCaptures( const MaximumCaptureDraughtsBoard &board, MaximumCapturePath &path, bool isKing, std::vector<MaximumCapturePath> &captures )
+{
+    typedef Geometry10x10MaximumCapture Geometry;
+    static const Pos directions[NumberOfDirections] = { { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } };
+
+    Pos from = Geometry::SquareToPos( path.GetFrom() );
+    auto isEmpty = [&]( const Pos &pos ) {
+        return board.IsPlayable( pos ) && ( board.GetPiece( pos ).pieceType == Piece::PieceType::None || pos == from );
+    };
+    Piece::PieceType opponent = board.GetCurrentSide() == MaximumCaptureDraughtsBoard::SideType::White ? Piece::PieceType::Black : Piece::PieceType::White;
+
+    bool isComplete = true;
+    for ( auto &direction : directions ) {
+        Pos jumped = Geometry::SquareToPos( path.GetTo() ) + direction;
+        while ( isKing && isEmpty( jumped ) ) { jumped = jumped + direction; }
+        if ( !board.IsPlayable( jumped ) || board.GetPiece( jumped ).pieceType != opponent ) { continue; }
+        uint64_t jumpedMask = Geometry::GetSquareMask( Geometry::PosToSquare( jumped ) );
+        if ( ( path.captured & jumpedMask ) != 0 ) { continue; }
+
+        for ( Pos landing = jumped + direction; isEmpty( landing ); landing = landing + direction ) {
+            isComplete = false;
+            path.AddSquare( Geometry::PosToSquare( landing ) );
+            path.captured |= jumpedMask;
+            AddAllCaptures( board, path, isKing, captures );
+            path.captured &= ~jumpedMask;
+            path.RemoveLastSquare();
+            if ( !isKing ) { break; }
+        }
+    }
+
+    if ( isComplete && path.IsCapture() ) { captures.push_back( path ); }
+}
+
+// Every capture sequence, whatever it takes, and whichever order it takes the pieces in.
+static std::vector<MaximumCapturePath> GetAllCaptures( const MaximumCaptureDraughtsBoard &board )
+{
+    std::vector<MaximumCapturePath> captures;
+    Piece::PieceType side = board.GetCurrentSide() == MaximumCaptureDraughtsBoard::SideType::White ? Piece::PieceType::White : Piece::PieceType::Black;
+    for ( int square = 0; square < Geometry10x10MaximumCapture::NumberOfPlayableSquares; square++ ) {
+        Piece piece = board.GetPiece( Geometry10x10MaximumCapture::SquareToPos( square ) );
+        if ( piece.pieceType != side ) { continue; }
+        MaximumCapturePath path{};
+        path.AddSquare( square );
+        AddAllCaptures( board, path, piece.isKing, captures );
+    }
+    return captures;
+}
+
+
+TEST( maximum_capture_test, test_only_longest_sequences )
+{
+    // The man can take one piece to the right, or two to the left.
+    auto board = MakeBoard<MaximumCaptureDraughtsBoard>( { { { 2, 3 }, Piece( Piece::PieceType::White ) },
+                                                           { { 3, 4 }, Piece( Piece::PieceType::Black ) },
+                                                           { { 3, 2 }, Piece( Piece::PieceType::Black ) },
+                                                           { { 5, 2 }, Piece( Piece::PieceType::Black ) } } );
+    EXPECT_EQ( 2u, GetAllCaptures( board ).size() );
+
+    MaximumCaptureDraughtsBoard::MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    ASSERT_EQ( 1, movePaths.size() );
+    EXPECT_EQ( 2, PopCount( movePaths[0].captured ) );
+
+    // Only the first hop of the longer sequence can be played on its own.
+    MaximumCaptureDraughtsBoard::MoveList moves;
+    board.GetMoves( moves );
+    ASSERT_EQ( 1, moves.size() );
+    EXPECT_EQ( MaximumCaptureDraughtsBoard::MoveError::None, board.GetMoveError( { { 2, 3 }, { 4, 1 } } ) );
+    EXPECT_EQ( MaximumCaptureDraughtsBoard::MoveError::NotMaximumCapture, board.GetMoveError( { { 2, 3 }, { 4, 5 } } ) );
+}
+
+TEST( maximum_capture_test, test_same_captures_returned_once )
+{
+    // The king can go round the four pieces either way and end where it started.
+    auto board = MakeBoard<MaximumCaptureDraughtsBoard>( { { { 2, 3 }, Piece( Piece::PieceType::White, true ) },
+                                                           { { 3, 4 }, Piece( Piece::PieceType::Black ) },
+                                                           { { 5, 4 }, Piece( Piece::PieceType::Black ) },
+                                                           { { 5, 2 }, Piece( Piece::PieceType::Black ) },
+                                                           { { 3, 2 }, Piece( Piece::PieceType::Black ) } } );
+    int routesHome = 0;
+    for ( auto &movePath : GetAllCaptures( board ) ) {
+        routesHome += movePath.GetTo() == movePath.GetFrom() && PopCount( movePath.captured ) == 4 ? 1 : 0;
+    }
+    EXPECT_EQ( 2, routesHome );
+
+    MaximumCaptureDraughtsBoard::MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    ASSERT_FALSE( movePaths.empty() );
+    routesHome = 0;
+    for ( int i = 0; i < movePaths.size(); i++ ) {
+        EXPECT_EQ( 4, PopCount( movePaths[i].captured ) );
+        routesHome += movePaths[i].GetTo() == movePaths[i].GetFrom() ? 1 : 0;
+        for ( int j = 0; j < i; j++ ) {
+            EXPECT_FALSE( movePaths[i].IsSameMove( movePaths[j] ) );
+        }
+    }
+    EXPECT_EQ( 1, routesHome );
+
+    // Either way round is a legal move.
+    for ( auto &movePath : GetAllCaptures( board ) ) {
+        if ( movePath.GetTo() == movePath.GetFrom() && PopCount( movePath.captured ) == 4 ) {
+            MaximumCaptureDraughtsBoard copy = board;
+            copy.DoMove( movePath );
+            EXPECT_EQ( 0, copy.GetPieceCount( MaximumCaptureDraughtsBoard::SideType::Black ) );
+        }
+    }
+}
+
+TEST( maximum_capture_test, test_men_capture_backwards )
+{
+    auto board = MakeBoard<MaximumCaptureDraughtsBoard>( { { { 4, 3 }, Piece( Piece::PieceType::White ) },
+                                                           { { 3, 2 }, Piece( Piece::PieceType::Black ) },
+                                                           { { 9, 0 }, Piece( Piece::PieceType::Black ) } } );
+    MaximumCaptureDraughtsBoard::MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    ASSERT_EQ( 1, movePaths.size() );
+    EXPECT_EQ( Geometry10x10MaximumCapture::PosToSquare( { 2, 1 } ), movePaths[0].GetTo() );
+
+    // Men still only step forwards.
+    EXPECT_EQ( MaximumCaptureDraughtsBoard::MoveError::None, board.GetMoveError( { { 4, 3 }, { 2, 1 } } ) );
+    EXPECT_EQ( MaximumCaptureDraughtsBoard::MoveError::IsBackwards, board.GetMoveError( { { 4, 3 }, { 3, 4 } } ) );
+}
+
+TEST( maximum_capture_test, test_men_capture_through_king_row )
+{
+    // The man reaches the king row on its first jump and carries on backwards as a man.
+    auto board = MakeBoard<MaximumCaptureDraughtsBoard>( { { { 7, 2 }, Piece( Piece::PieceType::White ) },
+                                                           { { 8, 3 }, Piece( Piece::PieceType::Black ) },
+                                                           { { 8, 5 }, Piece( Piece::PieceType::Black ) },
+                                                           { { 0, 9 }, Piece( Piece::PieceType::Black ) } } );
+    MaximumCaptureDraughtsBoard::MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    ASSERT_EQ( 1, movePaths.size() );
+    EXPECT_EQ( 2, PopCount( movePaths[0].captured ) );
+
+    MaximumCaptureDraughtsBoard wholeBoard = board;
+    wholeBoard.DoMove( movePaths[0] );
+    EXPECT_EQ( Piece( Piece::PieceType::White, false ), wholeBoard.GetPiece( { 7, 6 } ) );
+
+    // Played a hop at a time, the man isn't crowned on the way through.
+    board.DoMove( Move{ { 7, 2 }, { 9, 4 } } );
+    EXPECT_EQ( MaximumCaptureDraughtsBoard::SideType::White, board.GetCurrentSide() );
+    EXPECT_EQ( Piece( Piece::PieceType::White, false ), board.GetPiece( { 9, 4 } ) );
+    board.DoMove( Move{ { 9, 4 }, { 7, 6 } } );
+    EXPECT_EQ( wholeBoard, board );
+    EXPECT_EQ( wholeBoard.GetHash(), board.GetHash() );
+
+    // A capture that ends on the king row still crowns.
+    board = MakeBoard<MaximumCaptureDraughtsBoard>( { { { 7, 2 }, Piece( Piece::PieceType::White ) },
+                                                      { { 8, 3 }, Piece( Piece::PieceType::Black ) },
+                                                      { { 0, 9 }, Piece( Piece::PieceType::Black ) } } );
+    board.DoMove( Move{ { 7, 2 }, { 9, 4 } } );
+    EXPECT_EQ( MaximumCaptureDraughtsBoard::SideType::Black, board.GetCurrentSide() );
+    EXPECT_EQ( Piece( Piece::PieceType::White, true ), board.GetPiece( { 9, 4 } ) );
+    EXPECT_EQ( board.GetHash(), board.ComputeHash() );
+}
+
+TEST( maximum_capture_test, test_matches_all_captures )
+{
+    // Random games, the pruned search finds exactly the longest of all the capture sequences.
+    std::mt19937 rng( 17 );
+    int capturePositions = 0;
+    for ( int game = 0; game < 40; game++ ) {
+        MaximumCaptureDraughtsBoard board;
+        for ( int ply = 0; ply < 300 && !board.IsFinished(); ply++ ) {
+            MaximumCaptureDraughtsBoard::MovePathList movePaths;
+            board.GetMovePaths( movePaths );
+            ASSERT_FALSE( movePaths.empty() );
+
+            if ( movePaths[0].IsCapture() ) {
+                capturePositions++;
+                auto allCaptures = GetAllCaptures( board );
+                int most = 0;
+                for ( auto &capture : allCaptures ) { most = std::max( most, PopCount( capture.captured ) ); }
+
+                int expectedCount = 0;
+                for ( int i = 0; i < static_cast<int>( allCaptures.size() ); i++ ) {
+                    bool isRepeat = false;
+                    for ( int j = 0; j < i; j++ ) {
+                        isRepeat |= allCaptures[j].GetFrom() == allCaptures[i].GetFrom() && allCaptures[j].GetTo() == allCaptures[i].GetTo() &&
+                                    allCaptures[j].captured == allCaptures[i].captured;
+                    }
+                    expectedCount += PopCount( allCaptures[i].captured ) == most && !isRepeat ? 1 : 0;
+                }
+                ASSERT_EQ( expectedCount, movePaths.size() );
+                for ( auto &movePath : movePaths ) {
+                    ASSERT_EQ( most, PopCount( movePath.captured ) );
+
+                    // Played a hop at a time it's the same move.
+                    MaximumCaptureDraughtsBoard hopBoard = board;
+                    for ( int hop = 0; hop < movePath.GetHopCount(); hop++ ) {
+                        ASSERT_EQ( board.GetCurrentSide(), hopBoard.GetCurrentSide() );
+                        ASSERT_TRUE( hopBoard.CanMove( movePath.GetHop( hop ) ) );
+                        hopBoard.DoMove( movePath.GetHop( hop ) );
+                    }
+                    MaximumCaptureDraughtsBoard wholeBoard = board;
+                    wholeBoard.DoMove( movePath );
+                    ASSERT_EQ( wholeBoard, hopBoard );
+                    ASSERT_EQ( wholeBoard.GetHash(), hopBoard.GetHash() );
+                }
+            }
+
+            board.DoMove( movePaths[rng() % movePaths.size()] );
+            ASSERT_EQ( board.GetHash(), board.ComputeHash() );
+        }
+    }
+    EXPECT_GT( capturePositions, 100 );
+}
@@ -0,0 +1,77 @@
+#include "MobilityBoard.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace checkers;
+
+// Returns true if both move lists hold the same moves, in any order.
+static bool IsSameMoves( const MoveList &moves1, const MoveList &moves2 )
+{
+    if ( moves1.size() != moves2.size() ) { return false; }
+    for ( auto move : moves1 ) {
+        if ( std::find( moves2.begin(), moves2.end(), move ) == moves2.end() ) { return false; }
+    }
+    return true;
+}
+
+// Returns whether the tracked moves match a fresh generation from the board.
+static bool IsUpToDate( const MobilityBoard &mobilityBoard )
+{
+    MoveList moves;
+    mobilityBoard.GetMoves( moves );
+    MoveList boardMoves;
+    mobilityBoard.GetBoard().GetMoves( boardMoves );
+    return IsSameMoves( moves, boardMoves );
+}
+
+
+TEST( mobility_board_test, test_hop_moves_match_board )
+{
+    std::mt19937 rng( 17 );
+    for ( int game = 0; game < 20; game++ ) {
+        MobilityBoard mobilityBoard{ CheckersBoard() };
+        for ( int ply = 0; ply < 200 && !mobilityBoard.GetBoard().IsFinished(); ply++ ) {
+            ASSERT_TRUE( IsUpToDate( mobilityBoard ) ) << "game " << game << " ply " << ply;
+
+            MoveList moves;
+            mobilityBoard.GetMoves( moves );
+            mobilityBoard.DoMoveUnchecked( moves[rng() % moves.size()] );
+        }
+    }
+}
+
+TEST( mobility_board_test, test_do_and_undo_match_board )
+{
+    std::mt19937 rng( 23 );
+    MobilityBoard mobilityBoard{ CheckersBoard() };
+    std::vector<CheckersBoard::UndoRecord> undoRecords;
+
+    for ( int ply = 0; ply < 150 && !mobilityBoard.GetBoard().IsFinished(); ply++ ) {
+        MovePathList movePaths;
+        mobilityBoard.GetBoard().GetMovePaths( movePaths );
+        undoRecords.push_back( CheckersBoard::UndoRecord() );
+        mobilityBoard.DoMove( movePaths[rng() % movePaths.size()], undoRecords.back() );
+        ASSERT_TRUE( IsUpToDate( mobilityBoard ) );
+    }
+
+    while ( !undoRecords.empty() ) {
+        mobilityBoard.UndoMove( undoRecords.back() );
+        undoRecords.pop_back();
+        ASSERT_TRUE( IsUpToDate( mobilityBoard ) );
+    }
+    EXPECT_EQ( CheckersBoard(), mobilityBoard.GetBoard() );
+}
+
+TEST( mobility_board_test, test_quiet_move_updates_few_squares )
+{
+    MobilityBoard mobilityBoard{ CheckersBoard() };
+    mobilityBoard.DoMoveUnchecked( PackedMove( Move{ { 2, 1 }, { 3, 2 } } ) );
+
+    // Only the squares within jump distance of the two changed squares
+    EXPECT_LE( mobilityBoard.GetLastUpdateCount(), 14 );
+    EXPECT_TRUE( IsUpToDate( mobilityBoard ) );
+}
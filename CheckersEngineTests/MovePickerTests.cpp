@@ -0,0 +1,108 @@
+#include "CheckersBoard.h"
+#include "MovePicker.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace checkers;
+using PieceType = checkers::Piece::PieceType;
+
+static const PieceType EmptyPieceLayout[CheckersBoard::NumberOfSquares] {};
+
+static std::vector<int> GetPickOrder( MovePicker &movePicker )
+{
+    std::vector<int> order;
+    for ( int i = movePicker.Next(); i >= 0; i = movePicker.Next() ) {
+        order.push_back( i );
+    }
+    return order;
+}
+
+
+TEST( move_picker_test, test_picks_every_move_once )
+{
+    CheckersBoard board;
+    MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    MoveHistory history;
+
+    MovePicker movePicker( board, movePaths, 3, history, 0 );
+    std::vector<int> expected{ 3, 0, 1, 2, 4, 5, 6 };
+    EXPECT_EQ( expected, GetPickOrder( movePicker ) );
+    EXPECT_EQ( -1, movePicker.Next() );
+
+    // A hash move from another position can be out of range.
+    MovePicker badHashPicker( board, movePaths, 20, history, 0 );
+    EXPECT_EQ( 7u, GetPickOrder( badHashPicker ).size() );
+}
+
+TEST( move_picker_test, test_orders_captures )
+{
+    // A double capture of men, and a single capture of a king.
+    CheckersBoard board( EmptyPieceLayout, CheckersBoard::SideType::White );
+    board.SetPiece( { 0, 1 }, PieceType::White );
+    board.SetPiece( { 1, 2 }, PieceType::Black );
+    board.SetPiece( { 3, 4 }, PieceType::Black );
+    board.SetPiece( { 4, 1 }, PieceType::White );
+    board.SetPiece( { 5, 2 }, Piece( PieceType::Black, true ) );
+
+    MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    ASSERT_EQ( 2, movePaths.size() );
+    int doubleIndex = movePaths[0].GetHopCount() == 2 ? 0 : 1;
+    int kingIndex = 1 - doubleIndex;
+
+    MoveHistory history;
+    MovePicker movePicker( board, movePaths, -1, history, 0 );
+    EXPECT_EQ( doubleIndex, movePicker.Next() );
+    EXPECT_EQ( kingIndex, movePicker.Next() );
+    EXPECT_EQ( -1, movePicker.Next() );
+
+    MovePicker hashPicker( board, movePaths, kingIndex, history, 0 );
+    EXPECT_EQ( kingIndex, hashPicker.Next() );
+    EXPECT_EQ( doubleIndex, hashPicker.Next() );
+}
+
+TEST( move_picker_test, test_killers_and_history )
+{
+    CheckersBoard board;
+    MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+
+    MoveHistory history;
+    history.AddCutoff( movePaths[5], CheckersBoard::SideType::White, 3, 4 );
+    history.AddCutoff( movePaths[2], CheckersBoard::SideType::White, 3, 2 );
+    EXPECT_TRUE( history.IsKiller( movePaths[2], 3, 0 ) );
+    EXPECT_TRUE( history.IsKiller( movePaths[5], 3, 1 ) );
+    EXPECT_EQ( 16, history.GetScore( movePaths[5], CheckersBoard::SideType::White ) );
+    EXPECT_EQ( 0, history.GetScore( movePaths[5], CheckersBoard::SideType::Black ) );
+
+    // The hash move, the killers newest first, then the rest by history.
+    MovePicker killerPicker( board, movePaths, 0, history, 3 );
+    std::vector<int> killerOrder{ 0, 2, 5, 1, 3, 4, 6 };
+    EXPECT_EQ( killerOrder, GetPickOrder( killerPicker ) );
+
+    // No killers at this ply.
+    MovePicker historyPicker( board, movePaths, -1, history, 4 );
+    std::vector<int> historyOrder{ 5, 2, 0, 1, 3, 4, 6 };
+    EXPECT_EQ( historyOrder, GetPickOrder( historyPicker ) );
+
+    history.Clear();
+    EXPECT_FALSE( history.IsKiller( movePaths[2], 3, 0 ) );
+    EXPECT_EQ( 0, history.GetScore( movePaths[5], CheckersBoard::SideType::White ) );
+}
+
+TEST( move_picker_test, test_history_ages )
+{
+    CheckersBoard board;
+    MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+
+    MoveHistory history;
+    for ( int i = 0; i < 100; i++ ) {
+        history.AddCutoff( movePaths[0], CheckersBoard::SideType::White, 0, 200 );
+    }
+    EXPECT_LE( history.GetScore( movePaths[0], CheckersBoard::SideType::White ), MoveHistory::MaxScore );
+    EXPECT_GT( history.GetScore( movePaths[0], CheckersBoard::SideType::White ), MoveHistory::MaxScore / 4 );
+}
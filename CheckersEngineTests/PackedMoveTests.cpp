@@ -0,0 +1,56 @@
+#include "PackedMove.h"
+
+#include "gtest/gtest.h"
+
+using namespace checkers;
+
+TEST( packed_move_test, test_size )
+{
+    EXPECT_EQ( 2u, sizeof( PackedMove ) );
+}
+
+TEST( packed_move_test, test_round_trip )
+{
+    Move move{ {2, 1}, {3, 2} };
+    PackedMove packedMove( move );
+
+    EXPECT_EQ( PosToSquare( move.from ), packedMove.GetFrom() );
+    EXPECT_EQ( PosToSquare( move.to ), packedMove.GetTo() );
+    EXPECT_FALSE( packedMove.IsJump() );
+    EXPECT_EQ( Direction::UpRight, packedMove.GetDirection() );
+    EXPECT_EQ( move, Move( packedMove ) );
+}
+
+TEST( packed_move_test, test_jumped_square )
+{
+    // Jumps in every direction, on even and odd rows
+    Move moves[] = {
+        { {2, 1}, {4, 3} }, { {3, 2}, {5, 0} }, { {5, 4}, {3, 6} }, { {4, 7}, {2, 5} }
+    };
+
+    for ( auto move : moves ) {
+        PackedMove packedMove( move );
+        EXPECT_TRUE( packedMove.IsJump() );
+        EXPECT_EQ( move.GetJumpPos(), SquareToPos( packedMove.GetJumpedSquare() ) );
+        EXPECT_EQ( move, Move( packedMove ) );
+    }
+}
+
+TEST( packed_move_test, test_square_tables )
+{
+    // The tables agree with Pos arithmetic for every square and direction
+    const Pos deltas[NumberOfDirections] { Pos{ 1, 1 }, Pos{ 1, -1 }, Pos{ -1, 1 }, Pos{ -1, -1 } };
+    for ( int square = 0; square < NumberOfPlayableSquares; square++ ) {
+        for ( int i = 0; i < NumberOfDirections; i++ ) {
+            Direction direction = static_cast<Direction>( i );
+            Pos step = SquareToPos( square ) + deltas[i];
+            Pos jump = step + deltas[i];
+            bool isStepOnBoard = step.row >= 0 && step.row < 8 && step.column >= 0 && step.column < 8;
+            bool isJumpOnBoard = jump.row >= 0 && jump.row < 8 && jump.column >= 0 && jump.column < 8;
+
+            EXPECT_EQ( isStepOnBoard ? PosToSquare( step ) : -1, GetNeighbourSquare( square, direction ) );
+            EXPECT_EQ( isJumpOnBoard ? PosToSquare( jump ) : -1, GetJumpSquare( square, direction ) );
+            EXPECT_EQ( isJumpOnBoard ? SquareMask( PosToSquare( jump ) ) : 0, GetJumpMask( square, direction ) );
+        }
+    }
+}
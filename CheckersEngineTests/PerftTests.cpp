@@ -0,0 +1,41 @@
+#include "Perft.h"
+
+#include "gtest/gtest.h"
+
+using namespace checkers;
+
+
+TEST( perft_test, test_start_position_counts )
+{
+    CheckersBoard board;
+    for ( int depth = 1; depth <= 6; depth++ ) {
+        EXPECT_EQ( Perft::StartPositionCounts[depth - 1], Perft::Count( board, depth ) ) << "depth " << depth;
+    }
+    EXPECT_EQ( 1u, Perft::Count( board, 0 ) );
+    EXPECT_EQ( 0u, Perft::Count( board, -1 ) );
+    EXPECT_EQ( 0u, Perft::Run( board, -1 ).nodes );
+}
+
+TEST( perft_test, test_options_agree )
+{
+    CheckersBoard board;
+    const int depth = 6;
+
+    Perft::Options options;
+    options.isBulkCounting = false;
+    Perft::Result result = Perft::Run( board, depth, options );
+    EXPECT_EQ( Perft::StartPositionCounts[depth - 1], result.nodes );
+
+    options.isBulkCounting = true;
+    options.hashSizeMB = 1;
+    options.threadCount = 3;
+    Perft::Result threadedResult = Perft::Run( board, depth, options );
+    EXPECT_EQ( result.nodes, threadedResult.nodes );
+
+    // Divide has an entry for each root move, in the same order whatever the options
+    ASSERT_EQ( 7u, threadedResult.divide.size() );
+    for ( size_t i = 0; i < result.divide.size(); i++ ) {
+        EXPECT_EQ( result.divide[i].move, threadedResult.divide[i].move );
+        EXPECT_EQ( result.divide[i].nodes, threadedResult.divide[i].nodes );
+    }
+}
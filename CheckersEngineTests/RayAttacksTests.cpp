@@ -0,0 +1,283 @@
+#include "CheckersBoard.h"
+#include "RayAttacks.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace checkers;
+
+typedef BasicCheckersBoard<Geometry8x8FlyingKings> FlyingKingsBoard;
+
+// Walks each ray a square at a time, the way the fills should behave.
+template<typename Geometry>
+static typename Geometry::Bitboard WalkFill( typename Geometry::Bitboard generator, typename Geometry::Bitboard propagator, Direction direction )
+{
+    typename Geometry::Bitboard fill = generator;
+    while ( generator != 0 ) {
+        int square = SquareTables<Geometry>::GetNeighbourSquare( PopLowestSquare( generator ), direction );
+        for ( ; square >= 0 && ( propagator & Geometry::GetSquareMask( square ) ) != 0; square = SquareTables<Geometry>::GetNeighbourSquare( square, direction ) ) {
+            fill |= Geometry::GetSquareMask( square );
+        }
+    }
+    return fill;
+}
+
+template<typename Geometry>
+static void CheckFillsMatchWalking()
+{
+    typedef typename Geometry::Bitboard Bitboard;
+    std::mt19937_64 rng( 11 );
+    for ( int i = 0; i < 2000; i++ ) {
+        // Sparse generators and dense propagators, so the rays are long.
+        Bitboard generator = rng() & rng() & rng() & Geometry::GetAllSquares();
+        Bitboard propagator = ( rng() | rng() ) & Geometry::GetAllSquares() & ~generator;
+        for ( int j = 0; j < NumberOfDirections; j++ ) {
+            Direction direction = static_cast<Direction>( j );
+            ASSERT_EQ( WalkFill<Geometry>( generator, propagator, direction ), RayAttacks<Geometry>::OccludedFill( generator, propagator, direction ) );
+        }
+    }
+}
+
+// Sets up a board with only the given pieces, white to move.
+template<typename Board>
+static Board MakeBoard( const std::vector<std::pair<Pos, Piece>> &pieces )
+{
+    Piece::PieceType pieceTypes[Board::NumberOfSquares] = {};
+    Board board( pieceTypes, Board::SideType::White );
+    for ( auto &piece : pieces ) {
+        board.SetPiece( piece.first, piece.second );
+    }
+    return board;
+}
+
+// Plays every whole move a hop at a time. At each hop the hop-level moves have to be exactly the ways the whole moves
+// carry on, and the last hop has to leave the same board as the whole move.
+template<typename Board>
+static void CheckHopsMatchMovePaths( const Board &board, const typename Board::MovePathList &movePaths )
+{
+    for ( auto &movePath : movePaths ) {
+        Board hopBoard = board;
+        for ( int hop = 0; hop < movePath.GetHopCount(); hop++ ) {
+            ASSERT_EQ( board.GetCurrentSide(), hopBoard.GetCurrentSide() );
+
+            typename Board::MoveList moves;
+            hopBoard.GetMoves( moves );
+            for ( auto &move : moves ) {
+                bool isContinuation = false;
+                for ( auto &otherPath : movePaths ) {
+                    isContinuation |= otherPath.GetHopCount() > hop && otherPath.squares[hop] == move.GetFrom() && otherPath.squares[hop + 1] == move.GetTo() &&
+                                      ( hop == 0 || std::equal( otherPath.squares, otherPath.squares + hop + 1, movePath.squares ) );
+                }
+                ASSERT_TRUE( isContinuation );
+            }
+
+            ASSERT_EQ( Board::MoveError::None, hopBoard.GetMoveError( movePath.GetHop( hop ) ) );
+            hopBoard.DoMove( movePath.GetHop( hop ) );
+        }
+
+        Board wholeBoard = board;
+        wholeBoard.DoMoveUnchecked( movePath );
+        ASSERT_EQ( wholeBoard, hopBoard );
+        ASSERT_EQ( wholeBoard.GetHash(), hopBoard.GetHash() );
+    }
+}
+
+// Plays random games, checking the hop-level moves agree with the whole moves and everything undoes cleanly.
+template<typename Board>
+static void CheckRandomGames( const Board &startBoard )
+{
+    std::mt19937 rng( 3 );
+    for ( int game = 0; game < 20; game++ ) {
+        Board board = startBoard;
+        std::vector<typename Board::UndoRecord> undoRecords;
+
+        for ( int ply = 0; ply < 300 && !board.IsFinished(); ply++ ) {
+            typename Board::MovePathList movePaths;
+            board.GetMovePaths( movePaths );
+            ASSERT_FALSE( movePaths.empty() );
+
+            typename Board::MoveList moves;
+            board.GetMoves( moves );
+            for ( auto &movePath : movePaths ) {
+                ASSERT_TRUE( board.CanMove( movePath.GetFirstHop() ) );
+                bool isFound = false;
+                for ( auto &move : moves ) {
+                    isFound |= move.GetFrom() == movePath.squares[0] && move.GetTo() == movePath.squares[1];
+                }
+                ASSERT_TRUE( isFound );
+            }
+            CheckHopsMatchMovePaths( board, movePaths );
+
+            auto movePath = movePaths[rng() % movePaths.size()];
+            undoRecords.push_back( typename Board::UndoRecord() );
+            board.DoMove( movePath, undoRecords.back() );
+            ASSERT_EQ( board.GetHash(), board.ComputeHash() );
+        }
+
+        while ( !undoRecords.empty() ) {
+            board.UndoMove( undoRecords.back() );
+            undoRecords.pop_back();
+        }
+        EXPECT_EQ( startBoard, board );
+    }
+}
+
+
+TEST( ray_attacks_test, test_fills_match_walking )
+{
+    CheckFillsMatchWalking<Geometry8x8>();
+    CheckFillsMatchWalking<Geometry10x10>();
+}
+
+TEST( ray_attacks_test, test_king_slides_whole_diagonals )
+{
+    auto board = MakeBoard<FlyingKingsDraughtsBoard>( { { { 4, 5 }, Piece( Piece::PieceType::White, true ) },
+                                                        { { 9, 2 }, Piece( Piece::PieceType::Black ) } } );
+    FlyingKingsDraughtsBoard::MoveList moves;
+    board.GetMoves( moves );
+    EXPECT_EQ( 17, moves.size() );
+    EXPECT_TRUE( board.CanMove( { { 4, 5 }, { 9, 0 } } ) );
+    EXPECT_TRUE( board.CanMove( { { 4, 5 }, { 0, 9 } } ) );
+
+    // Short kings still step a single square.
+    auto shortBoard = MakeBoard<DraughtsBoard>( { { { 4, 5 }, Piece( Piece::PieceType::White, true ) },
+                                                  { { 9, 2 }, Piece( Piece::PieceType::Black ) } } );
+    DraughtsBoard::MoveList shortMoves;
+    shortBoard.GetMoves( shortMoves );
+    EXPECT_EQ( 4, shortMoves.size() );
+    EXPECT_EQ( DraughtsBoard::MoveError::TooFar, shortBoard.GetMoveError( { { 4, 5 }, { 9, 0 } } ) );
+}
+
+TEST( ray_attacks_test, test_king_captures_along_diagonal )
+{
+    auto board = MakeBoard<FlyingKingsDraughtsBoard>( { { { 4, 5 }, Piece( Piece::PieceType::White, true ) },
+                                                        { { 7, 2 }, Piece( Piece::PieceType::Black ) },
+                                                        { { 6, 7 }, Piece( Piece::PieceType::Black ) },
+                                                        { { 8, 9 }, Piece( Piece::PieceType::Black ) },
+                                                        { { 3, 4 }, Piece( Piece::PieceType::White ) } } );
+
+    // The capture is forced, the king can land on any square behind the captured piece up to the next piece.
+    FlyingKingsDraughtsBoard::MoveList moves;
+    board.GetMoves( moves );
+    EXPECT_EQ( 2 + 1, moves.size() );
+    for ( auto &move : moves ) {
+        EXPECT_TRUE( move.IsJump() );
+    }
+    EXPECT_EQ( FlyingKingsDraughtsBoard::MoveError::MustJump, board.GetMoveError( { { 4, 5 }, { 1, 8 } } ) );
+    EXPECT_EQ( FlyingKingsDraughtsBoard::MoveError::None, board.GetMoveError( { { 4, 5 }, { 9, 0 } } ) );
+
+    // A king can't pass its own pieces.
+    EXPECT_EQ( FlyingKingsDraughtsBoard::MoveError::NoJumpPiece, board.GetMoveError( { { 4, 5 }, { 1, 2 } } ) );
+
+    board.DoMove( Move{ { 4, 5 }, { 9, 0 } } );
+    EXPECT_EQ( Piece::PieceType::None, board.GetPiece( { 7, 2 } ).pieceType );
+    EXPECT_EQ( FlyingKingsDraughtsBoard::SideType::Black, board.GetCurrentSide() );
+    EXPECT_EQ( board.GetHash(), board.ComputeHash() );
+}
+
+TEST( ray_attacks_test, test_king_capture_sequences )
+{
+    auto board = MakeBoard<FlyingKingsBoard>( { { { 0, 1 }, Piece( Piece::PieceType::White, true ) },
+                                                { { 2, 3 }, Piece( Piece::PieceType::Black ) },
+                                                { { 5, 4 }, Piece( Piece::PieceType::Black ) } } );
+
+    // Landing on (4,5) carries on over (5,4), every other landing ends the move.
+    FlyingKingsBoard::MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    int doubleCaptures = 0;
+    for ( auto &movePath : movePaths ) {
+        doubleCaptures += PopCount( movePath.captured ) == 2 ? 1 : 0;
+    }
+    EXPECT_EQ( 3 + 2, movePaths.size() );
+    EXPECT_EQ( 2, doubleCaptures );
+
+    // Played a hop at a time, the king keeps the move while it can capture again.
+    board.DoMove( Move{ { 0, 1 }, { 4, 5 } } );
+    EXPECT_EQ( FlyingKingsBoard::SideType::White, board.GetCurrentSide() );
+    board.DoMove( Move{ { 4, 5 }, { 7, 2 } } );
+    EXPECT_EQ( FlyingKingsBoard::SideType::Black, board.GetCurrentSide() );
+    EXPECT_EQ( 0, board.GetPieceCount( FlyingKingsBoard::SideType::Black ) );
+}
+
+TEST( ray_attacks_test, test_capturing_king_carries_on )
+{
+    auto board = MakeBoard<FlyingKingsBoard>( { { { 0, 1 }, Piece( Piece::PieceType::White, true ) },
+                                                { { 7, 0 }, Piece( Piece::PieceType::White, true ) },
+                                                { { 2, 3 }, Piece( Piece::PieceType::Black ) },
+                                                { { 5, 4 }, Piece( Piece::PieceType::Black ) },
+                                                { { 6, 1 }, Piece( Piece::PieceType::Black ) } } );
+
+    // Part way through the sequence the taken piece is still on the board, and the other king has to wait.
+    board.DoMove( Move{ { 0, 1 }, { 4, 5 } } );
+    ASSERT_EQ( FlyingKingsBoard::SideType::White, board.GetCurrentSide() );
+    EXPECT_EQ( Piece::PieceType::Black, board.GetPiece( { 2, 3 } ).pieceType );
+    EXPECT_EQ( FlyingKingsBoard::MoveError::MustContinueCapture, board.GetMoveError( { { 7, 0 }, { 5, 2 } } ) );
+
+    FlyingKingsBoard::MoveList moves;
+    board.GetMoves( moves );
+    ASSERT_FALSE( moves.empty() );
+    for ( auto &move : moves ) {
+        EXPECT_EQ( Geometry8x8FlyingKings::PosToSquare( { 4, 5 } ), move.GetFrom() );
+    }
+
+    // Both taken pieces go when the move is over.
+    board.DoMove( Move{ { 4, 5 }, { 6, 3 } } );
+    EXPECT_EQ( FlyingKingsBoard::SideType::Black, board.GetCurrentSide() );
+    EXPECT_EQ( 1, board.GetPieceCount( FlyingKingsBoard::SideType::Black ) );
+    EXPECT_EQ( board.GetHash(), board.ComputeHash() );
+}
+
+TEST( ray_attacks_test, test_captured_pieces_block_rays )
+{
+    // Every hop takes exactly one piece, a piece already taken blocks the ray instead of being taken again.
+    auto board = MakeBoard<FlyingKingsBoard>( { { { 1, 0 }, Piece( Piece::PieceType::White, true ) },
+                                                { { 3, 2 }, Piece( Piece::PieceType::Black ) },
+                                                { { 5, 2 }, Piece( Piece::PieceType::Black ) },
+                                                { { 5, 6 }, Piece( Piece::PieceType::Black ) } } );
+    FlyingKingsBoard::MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    for ( auto &movePath : movePaths ) {
+        EXPECT_EQ( PopCount( movePath.captured ), movePath.GetHopCount() );
+    }
+    CheckRandomGames( board );
+}
+
+TEST( ray_attacks_test, test_more_moves_than_inline_capacity )
+{
+    // Six kings against twenty men have more whole moves than the list keeps inline, none of them may be lost.
+    std::vector<std::pair<Pos, Piece>> pieces;
+    for ( Pos pos : std::vector<Pos>{ { 2, 7 }, { 3, 4 }, { 5, 8 }, { 6, 9 }, { 8, 9 }, { 9, 8 } } ) {
+        pieces.push_back( { pos, Piece( Piece::PieceType::White, true ) } );
+    }
+    for ( Pos pos : std::vector<Pos>{ { 1, 0 }, { 1, 2 }, { 1, 4 }, { 1, 6 }, { 1, 8 }, { 2, 3 }, { 3, 2 }, { 3, 6 }, { 3, 8 }, { 4, 1 },
+                                      { 4, 3 }, { 4, 9 }, { 5, 0 }, { 5, 4 }, { 6, 7 }, { 7, 6 }, { 8, 1 }, { 8, 3 }, { 8, 5 }, { 8, 7 } } ) {
+        pieces.push_back( { pos, Piece( Piece::PieceType::Black ) } );
+    }
+    auto board = MakeBoard<FlyingKingsDraughtsBoard>( pieces );
+
+    FlyingKingsDraughtsBoard::MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+    ASSERT_EQ( 839, movePaths.size() );
+    EXPECT_GT( movePaths.size(), Geometry10x10FlyingKings::MaxMovePaths );
+
+    for ( int i = 0; i < movePaths.size(); i++ ) {
+        EXPECT_EQ( PopCount( movePaths[i].captured ), movePaths[i].GetHopCount() );
+        EXPECT_EQ( movePaths.end(), std::find( movePaths.begin() + i + 1, movePaths.end(), movePaths[i] ) );
+    }
+
+    // The last move generated is as legal as the first.
+    FlyingKingsDraughtsBoard lastMoveBoard = board;
+    lastMoveBoard.DoMove( movePaths.back() );
+    EXPECT_EQ( FlyingKingsDraughtsBoard::SideType::Black, lastMoveBoard.GetCurrentSide() );
+
+    CheckHopsMatchMovePaths( board, movePaths );
+}
+
+TEST( ray_attacks_test, test_flying_kings_random_games )
+{
+    CheckRandomGames( BasicCheckersBoard<Geometry8x8FlyingKings>() );
+    CheckRandomGames( FlyingKingsDraughtsBoard() );
+}
@@ -0,0 +1,109 @@
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+using namespace checkers;
+
+
+TEST( thread_pool_test, test_runs_every_task )
+{
+    ThreadPool pool( 3 );
+    EXPECT_EQ( 3, pool.GetWorkerCount() );
+
+    std::atomic<int> sum( 0 );
+    TaskGroup group( pool );
+    for ( int i = 1; i <= 1000; i++ ) {
+        group.Run( [&sum, i]() { sum += i; } );
+    }
+    group.Wait();
+    EXPECT_EQ( 500500, sum.load() );
+
+    // A group can be used again after waiting.
+    group.Run( [&sum]() { sum = 0; } );
+    group.Wait();
+    EXPECT_EQ( 0, sum.load() );
+}
+
+TEST( thread_pool_test, test_nested_groups )
+{
+    // More nested waits than workers, the waiting tasks have to run the queued ones.
+    ThreadPool pool( 2 );
+    std::atomic<int> count( 0 );
+    TaskGroup outerGroup( pool );
+    for ( int i = 0; i < 8; i++ ) {
+        outerGroup.Run( [&pool, &count]() {
+            TaskGroup innerGroup( pool );
+            for ( int j = 0; j < 8; j++ ) {
+                innerGroup.Run( [&count]() { count++; } );
+            }
+            innerGroup.Wait();
+        } );
+    }
+    outerGroup.Wait();
+    EXPECT_EQ( 64, count.load() );
+}
+
+TEST( thread_pool_test, test_cancel_skips_tasks )
+{
+    ThreadPool pool( 1 );
+    std::atomic<bool> isStarted( false );
+    std::atomic<bool> isReleased( false );
+    std::atomic<int> count( 0 );
+
+    // Hold up the only worker so the rest of the group is still queued when it's cancelled.
+    TaskGroup group( pool );
+    group.Run( [&]() {
+        isStarted = true;
+        while ( !isReleased ) { std::this_thread::yield(); }
+    } );
+    while ( !isStarted ) { std::this_thread::yield(); }
+
+    for ( int i = 0; i < 10; i++ ) {
+        group.Run( [&count]() { count++; } );
+    }
+    EXPECT_FALSE( group.IsCancelled() );
+    group.Cancel();
+    EXPECT_TRUE( group.IsCancelled() );
+    EXPECT_TRUE( group.GetCancelFlag()->load() );
+    isReleased = true;
+    group.Wait();
+    EXPECT_EQ( 0, count.load() );
+}
+
+TEST( thread_pool_test, test_cancel_flag_stops_running_task )
+{
+    ThreadPool pool( 1 );
+    std::atomic<bool> isStarted( false );
+    TaskGroup group( pool );
+    group.Run( [&]() {
+        isStarted = true;
+        while ( !group.IsCancelled() ) { std::this_thread::yield(); }
+    } );
+    while ( !isStarted ) { std::this_thread::yield(); }
+    group.Cancel();
+    group.Wait();
+}
+
+TEST( thread_pool_test, test_pinned_pool )
+{
+    ThreadPool pool( 2, true );
+    std::atomic<int> count( 0 );
+    {
+        // The destructor waits.
+        TaskGroup group( pool );
+        for ( int i = 0; i < 100; i++ ) {
+            group.Run( [&count]() { count++; } );
+        }
+    }
+    EXPECT_EQ( 100, count.load() );
+}
+
+TEST( thread_pool_test, test_instance )
+{
+    EXPECT_GE( ThreadPool::GetInstance().GetWorkerCount(), 1 );
+    EXPECT_EQ( &ThreadPool::GetInstance(), &ThreadPool::GetInstance() );
+    EXPECT_FALSE( ThreadPool::ConfigureInstance( 4, false ) );
+}
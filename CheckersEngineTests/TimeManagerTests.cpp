@@ -0,0 +1,70 @@
+#include "CheckersBoard.h"
+#include "TimeManager.h"
+
+#include "gtest/gtest.h"
+
+using namespace checkers;
+using PieceType = checkers::Piece::PieceType;
+
+static const PieceType EmptyPieceLayout[CheckersBoard::NumberOfSquares] {};
+
+
+TEST( time_manager_test, test_estimates_moves_to_go )
+{
+    CheckersBoard board;
+    EXPECT_EQ( 36, TimeManager::EstimateMovesToGo( board ) );
+
+    CheckersBoard endgameBoard( EmptyPieceLayout, CheckersBoard::SideType::White );
+    endgameBoard.SetPiece( { 2, 1 }, Piece( PieceType::White, true ) );
+    endgameBoard.SetPiece( { 5, 2 }, PieceType::Black );
+    EXPECT_EQ( 14, TimeManager::EstimateMovesToGo( endgameBoard ) );
+}
+
+TEST( time_manager_test, test_allocation )
+{
+    CheckersBoard board;
+    TimeManager::Clock clock;
+    clock.remainingSeconds = 60;
+    TimeManager timeManager( board, clock );
+    double availableSeconds = 60 - TimeManager::MoveOverheadSeconds;
+    EXPECT_DOUBLE_EQ( availableSeconds / 36, timeManager.GetOptimumSeconds() );
+    EXPECT_DOUBLE_EQ( timeManager.GetOptimumSeconds() * TimeManager::MaximumFactor, timeManager.GetMaximumSeconds() );
+
+    // The increment is mostly spent as it comes.
+    clock.incrementSeconds = 1;
+    EXPECT_DOUBLE_EQ( availableSeconds / 36 + 0.75, TimeManager( board, clock ).GetOptimumSeconds() );
+
+    // Never more than half the clock, unless it's the last move before a top up.
+    clock.incrementSeconds = 0;
+    clock.movesToGo = 2;
+    EXPECT_DOUBLE_EQ( availableSeconds / 2, TimeManager( board, clock ).GetMaximumSeconds() );
+    clock.movesToGo = 1;
+    EXPECT_DOUBLE_EQ( availableSeconds, TimeManager( board, clock ).GetOptimumSeconds() );
+    EXPECT_DOUBLE_EQ( availableSeconds, TimeManager( board, clock ).GetMaximumSeconds() );
+
+    // Out of time.
+    clock.remainingSeconds = 0;
+    EXPECT_EQ( 0, TimeManager( board, clock ).GetMaximumSeconds() );
+}
+
+TEST( time_manager_test, test_iteration_stability )
+{
+    CheckersBoard board;
+    MovePathList movePaths;
+    board.GetMovePaths( movePaths );
+
+    TimeManager::Clock clock;
+    clock.remainingSeconds = 10;
+    clock.movesToGo = 1;
+    TimeManager stableManager( board, clock );
+    double elapsedSeconds = stableManager.GetOptimumSeconds() * 0.45;
+
+    // The same best move again means the search has settled, so it stops sooner.
+    EXPECT_TRUE( stableManager.ShouldStartIteration( elapsedSeconds, movePaths[0] ) );
+    EXPECT_FALSE( stableManager.ShouldStartIteration( elapsedSeconds, movePaths[0] ) );
+
+    TimeManager unstableManager( board, clock );
+    EXPECT_TRUE( unstableManager.ShouldStartIteration( elapsedSeconds, movePaths[0] ) );
+    EXPECT_TRUE( unstableManager.ShouldStartIteration( elapsedSeconds, movePaths[1] ) );
+    EXPECT_FALSE( unstableManager.ShouldStartIteration( unstableManager.GetOptimumSeconds(), movePaths[1] ) );
+}
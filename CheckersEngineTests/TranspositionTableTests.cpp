@@ -0,0 +1,205 @@
+#include "AIPlayer.h"
+#include "AlphaBetaSearch.h"
+#include "CheckersBoard.h"
+#include "TranspositionTable.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace checkers;
+
+typedef TranspositionTable::Bound Bound;
+
+// Keys that all land in the first bucket.
+static uint64_t GetBucketKey( const TranspositionTable &table, int index )
+{
+    return static_cast<uint64_t>( index + 1 ) * table.GetBucketCount();
+}
+
+
+TEST( transposition_table_test, test_size )
+{
+    TranspositionTable table( 1 );
+    EXPECT_EQ( 1024u * 1024u, table.GetSizeBytes() );
+    EXPECT_EQ( 1024u * 1024u / 64u, table.GetBucketCount() );
+
+    table.Resize( 3 );
+    EXPECT_EQ( 2u * 1024u * 1024u, table.GetSizeBytes() );
+
+    TranspositionTable tinyTable( 0 );
+    EXPECT_EQ( 1u, tinyTable.GetBucketCount() );
+}
+
+TEST( transposition_table_test, test_store_and_probe )
+{
+    TranspositionTable table( 1 );
+    TranspositionTable::ProbeResult result;
+    EXPECT_FALSE( table.Probe( 12345, result ) );
+
+    table.Store( 12345, 7, Bound::Upper, -2999, 42 );
+    ASSERT_TRUE( table.Probe( 12345, result ) );
+    EXPECT_EQ( -2999, result.score );
+    EXPECT_EQ( 7, result.depth );
+    EXPECT_EQ( Bound::Upper, result.bound );
+    EXPECT_EQ( 42, result.moveIndex );
+
+    // Storing the same position again replaces its entry.
+    table.Store( 12345, 9, Bound::Exact, 29990, 3 );
+    ASSERT_TRUE( table.Probe( 12345, result ) );
+    EXPECT_EQ( 29990, result.score );
+    EXPECT_EQ( 9, result.depth );
+    EXPECT_EQ( 0u, table.GetStatistics().collisions );
+
+    EXPECT_EQ( 3u, table.GetStatistics().probes );
+    EXPECT_EQ( 2u, table.GetStatistics().hits );
+    EXPECT_EQ( 2u, table.GetStatistics().stores );
+
+    table.Clear();
+    EXPECT_FALSE( table.Probe( 12345, result ) );
+    EXPECT_EQ( 1u, table.GetStatistics().probes );
+}
+
+TEST( transposition_table_test, test_replaces_shallowest )
+{
+    TranspositionTable table( 1 );
+    TranspositionTable::ProbeResult result;
+    for ( int i = 0; i < TranspositionTable::EntriesPerBucket; i++ ) {
+        table.Store( GetBucketKey( table, i ), 10 - i, Bound::Exact, i, 0 );
+    }
+    EXPECT_EQ( 0u, table.GetStatistics().collisions );
+
+    table.Store( GetBucketKey( table, 4 ), 5, Bound::Exact, 4, 0 );
+    EXPECT_EQ( 1u, table.GetStatistics().collisions );
+    EXPECT_FALSE( table.Probe( GetBucketKey( table, 3 ), result ) );
+    EXPECT_TRUE( table.Probe( GetBucketKey( table, 0 ), result ) );
+    EXPECT_TRUE( table.Probe( GetBucketKey( table, 4 ), result ) );
+}
+
+TEST( transposition_table_test, test_replaces_older_searches_first )
+{
+    TranspositionTable table( 1 );
+    TranspositionTable::ProbeResult result;
+    for ( int i = 0; i < TranspositionTable::EntriesPerBucket; i++ ) {
+        table.Store( GetBucketKey( table, i ), 10, Bound::Exact, i, 0 );
+        table.NewSearch();
+    }
+
+    // All the same depth, so the entry from the first search goes.
+    table.Store( GetBucketKey( table, 4 ), 1, Bound::Exact, 4, 0 );
+    EXPECT_FALSE( table.Probe( GetBucketKey( table, 0 ), result ) );
+    EXPECT_TRUE( table.Probe( GetBucketKey( table, 1 ), result ) );
+}
+
+TEST( transposition_table_test, test_concurrent_stores_stay_whole )
+{
+    // One bucket, so every thread is fighting over the same four entries.
+    TranspositionTable table( 0 );
+    const int NumberOfThreads = 4;
+    const int NumberOfKeys = 64;
+    std::atomic<int> mismatches( 0 );
+    std::atomic<int> hits( 0 );
+
+    // Everything stored for a key is made from the key, so a probe that mixed two stores shows up.
+    std::vector<std::thread> threads;
+    for ( int t = 0; t < NumberOfThreads; t++ ) {
+        threads.emplace_back( [&table, &mismatches, &hits, t, NumberOfKeys]()
+        {
+            TranspositionTable::Statistics statistics;
+            TranspositionTable::ProbeResult result;
+            for ( int i = 0; i < 200000; i++ ) {
+                int k = ( i * 7 + t ) % NumberOfKeys;
+                uint64_t key = 0x9E3779B97F4A7C15ull * static_cast<uint64_t>( k + 1 );
+                if ( i % 2 == 0 ) {
+                    table.Store( key, k + 1, Bound::Lower, k * 100 - 3000, k, statistics );
+                }
+                else if ( table.Probe( key, result, statistics ) ) {
+                    hits++;
+                    if ( result.depth != k + 1 || result.score != k * 100 - 3000 || result.bound != Bound::Lower || result.moveIndex != k ) {
+                        mismatches++;
+                    }
+                }
+            }
+            table.AddStatistics( statistics );
+        } );
+    }
+    for ( auto &thread : threads ) {
+        thread.join();
+    }
+
+    EXPECT_EQ( 0, mismatches.load() );
+    EXPECT_GT( hits.load(), 0 );
+    EXPECT_EQ( NumberOfThreads * 100000u, table.GetStatistics().stores );
+    EXPECT_EQ( NumberOfThreads * 100000u, table.GetStatistics().probes );
+    EXPECT_EQ( static_cast<uint64_t>( hits.load() ), table.GetStatistics().hits );
+}
+
+TEST( transposition_table_test, test_search_reuses_results )
+{
+    CheckersBoard board;
+    AlphaBetaSearch search;
+    auto result = search.Search( board, 9 );
+
+    TranspositionTable table( 4 );
+    AlphaBetaSearch hashSearch( &table );
+    auto hashResult = hashSearch.Search( board, 9 );
+    EXPECT_EQ( result.depth, hashResult.depth );
+    EXPECT_LT( hashResult.nodes, result.nodes );
+    EXPECT_GT( table.GetStatistics().hits, 0u );
+    EXPECT_TRUE( board.CanMove( hashResult.bestMove.GetFirstHop() ) );
+
+    // Searching again starts from what the last search found.
+    table.NewSearch();
+    auto repeatResult = hashSearch.Search( board, 9 );
+    EXPECT_LT( repeatResult.nodes, hashResult.nodes );
+    EXPECT_EQ( hashResult.score, repeatResult.score );
+}
+
+TEST( transposition_table_test, test_ai_player_keeps_table )
+{
+    AIPlayer aiPlayer;
+    aiPlayer.SetSearchMode( AIPlayer::SearchMode::AlphaBeta );
+    aiPlayer.SetSearchDepth( 6 );
+    aiPlayer.SetHashSizeMB( 1 );
+    EXPECT_EQ( nullptr, aiPlayer.GetTranspositionTable() );
+
+    CheckersBoard board;
+    aiPlayer.ChooseBestMove( board );
+    ASSERT_NE( nullptr, aiPlayer.GetTranspositionTable() );
+    uint64_t stores = aiPlayer.GetTranspositionTable()->GetStatistics().stores;
+    EXPECT_GT( stores, 0u );
+
+    aiPlayer.ChooseBestMove( board );
+    EXPECT_GT( aiPlayer.GetTranspositionTable()->GetStatistics().stores, stores );
+
+    aiPlayer.SetHashSizeMB( 0 );
+    aiPlayer.ChooseBestMove( board );
+    EXPECT_EQ( nullptr, aiPlayer.GetTranspositionTable() );
+}
+
+TEST( transposition_table_test, test_searches_share_table )
+{
+    CheckersBoard board;
+    TranspositionTable table( 4 );
+    std::vector<AlphaBetaSearch::Result> results( 4 );
+    std::vector<std::thread> threads;
+    for ( size_t i = 0; i < results.size(); i++ ) {
+        // Each thread has its own board, the board caches its jumpers.
+        threads.emplace_back( [&table, board, &results, i]()
+        {
+            AlphaBetaSearch sharedSearch( &table );
+            results[i] = sharedSearch.Search( board, 8 );
+        } );
+    }
+    for ( auto &thread : threads ) {
+        thread.join();
+    }
+
+    for ( auto &sharedResult : results ) {
+        EXPECT_EQ( 8, sharedResult.depth );
+        EXPECT_TRUE( board.CanMove( sharedResult.bestMove.GetFirstHop() ) );
+    }
+    EXPECT_GT( table.GetStatistics().hits, 0u );
+}
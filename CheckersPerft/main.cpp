@@ -0,0 +1,64 @@
+#include "CheckersBoard.h"
+#include "Perft.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace checkers;
+
+static void PrintUsage()
+{
+    std::printf( "Usage: CheckersPerft [depth] [--divide] [--no-bulk] [--hash MB] [--threads N]\n"
+                 "Counts the positions from the start position up to depth, default 10.\n" );
+}
+
+static void PrintMove( const MovePath &movePath )
+{
+    for ( int i = 0; i < movePath.squareCount; i++ ) {
+        Pos pos = SquareToPos( movePath.squares[i] );
+        std::printf( "%s%c%d", i == 0 ? "" : ( movePath.IsCapture() ? "x" : "-" ), 'a' + pos.column, pos.row + 1 );
+    }
+}
+
+int main( int argc, char *argv[] )
+{
+    int maxDepth = 10;
+    bool isDivide = false;
+    Perft::Options options;
+
+    for ( int i = 1; i < argc; i++ ) {
+        if ( std::strcmp( argv[i], "--divide" ) == 0 ) { isDivide = true; }
+        else if ( std::strcmp( argv[i], "--no-bulk" ) == 0 ) { options.isBulkCounting = false; }
+        else if ( std::strcmp( argv[i], "--hash" ) == 0 && i + 1 < argc ) { options.hashSizeMB = std::atoi( argv[++i] ); }
+        else if ( std::strcmp( argv[i], "--threads" ) == 0 && i + 1 < argc ) { options.threadCount = std::atoi( argv[++i] ); }
+        else if ( argv[i][0] != '-' ) { maxDepth = std::atoi( argv[i] ); }
+        else { PrintUsage(); return 1; }
+    }
+
+    CheckersBoard board;
+    bool isAllMatching = true;
+    for ( int depth = 1; depth <= maxDepth; depth++ ) {
+        Perft::Result result = Perft::Run( board, depth, options );
+
+        const char *check = "";
+        if ( depth <= Perft::NumberOfStartPositionCounts ) {
+            bool isMatching = result.nodes == Perft::StartPositionCounts[depth - 1];
+            isAllMatching = isAllMatching && isMatching;
+            check = isMatching ? "ok" : "MISMATCH";
+        }
+        std::printf( "depth %2d  nodes %12llu  time %8.3fs  nps %12llu  %s\n", depth,
+                     static_cast<unsigned long long>( result.nodes ), result.seconds,
+                     static_cast<unsigned long long>( result.GetNodesPerSecond() ), check );
+    }
+
+    if ( isDivide ) {
+        Perft::Result result = Perft::Run( board, maxDepth, options );
+        for ( auto &entry : result.divide ) {
+            PrintMove( entry.move );
+            std::printf( "  %llu\n", static_cast<unsigned long long>( entry.nodes ) );
+        }
+    }
+
+    return isAllMatching ? 0 : 1;
+}